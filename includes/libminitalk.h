@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libminitalk.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:07:16 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:28:06 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LIBMINITALK_H
+# define LIBMINITALK_H
+
+/* --- Includes --- */
+// For pid_t
+# include <sys/types.h>
+// For size_t
+# include <stddef.h>
+
+/*
+ * libminitalk.a: the client's sender as a library, so a program can talk
+ * to a server without paying a fork/exec of ./client per message.
+ * Link with: -L<minitalk> -L<minitalk>/libft -lminitalk -lft
+ *
+ * A connection is opened once and reused for any number of messages. In
+ * a bonus build, mt_send() returns only after the server acknowledged the
+ * message, so consecutive sends never overlap on the server. Signals are
+ * process-wide: use the connections of a process from a single thread.
+ * All functions return -1 (or NULL) and set errno on failure.
+ */
+typedef struct s_mt_conn	t_mt_conn;
+
+t_mt_conn	*mt_open(pid_t pid);
+int			mt_send(t_mt_conn *conn, const void *buf, size_t len);
+void		mt_close(t_mt_conn *conn);
+
+/*
+ * Pipelined session: between mt_session_begin() and mt_session_end(),
+ * every mt_send() on the connection is one framed message of a single
+ * stream. The server keeps its state between them and (bonus build) only
+ * ACKs every few messages, which mt_send() waits for, and at the end. A
+ * message of a session must not contain the byte 0x1E, which ends it.
+ * Not available in FEC builds (ENOTSUP). mt_close() ends an open session.
+ */
+int			mt_session_begin(t_mt_conn *conn);
+int			mt_session_end(t_mt_conn *conn);
+
+/*
+ * Asynchronous sender: one loop drives any number of transfers to any
+ * number of servers from a single thread. Every tick of a timerfd sends
+ * the next bit of each transfer in flight, and the ACKs come back through
+ * a signalfd. Transfers to the same server go one after the other, in the
+ * order they were queued. When a transfer ends, `done` gets its id and
+ * 0 or an errno value: ETIMEDOUT once the ACK (bonus build) is still
+ * missing after MT_ASYNC_RETRIES retransmissions, or ECANCELED when the
+ * loop is closed first. A retransmitted message may be printed twice.
+ *
+ * `done` may queue new transfers. Do not mix with blocking mt_send() calls
+ * while transfers are in flight: both read the same ACK signals.
+ */
+typedef struct s_mt_loop	t_mt_loop;
+typedef void				(*t_mt_done)(void *arg, long id, pid_t pid,
+								int error);
+
+t_mt_loop	*mt_loop_open(t_mt_done done, void *arg);
+long		mt_send_async(t_mt_loop *loop, pid_t pid, const void *buf,
+				size_t len);
+int			mt_loop_step(t_mt_loop *loop);
+int			mt_loop_run(t_mt_loop *loop);
+void		mt_loop_close(t_mt_loop *loop);
+#endif
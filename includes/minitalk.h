@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/03 14:46:15 by fyudris           #+#    #+#             */
-/*   Updated: 2025/06/05 20:25:22 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 15:15:41 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,11 +22,24 @@
 # include <stdlib.h>
 // For size_t
 # include <stddef.h>
+// For uint64_t
+# include <stdint.h>
+// For pthread_create, pthread_sigmask, pthread_mutex_t (server -t)
+# include <pthread.h>
+// For sem_t (server -t)
+# include <semaphore.h>
+// For the lock-free event queues (server -t)
+# include <stdatomic.h>
+// For clock_gettime, struct timespec (ACK deadlines)
+# include <time.h>
 
 /* --- Libft Include --- */
 # include "../libft/includes/libft.h"
 # include "../libft/includes/ft_printf.h"
 
+/* --- Public API of the client library --- */
+# include "libminitalk.h"
+
 /* --- Project-Specific Definitions --- */
 
 // Return status codes
@@ -40,26 +53,260 @@
 // Signal definitions
 # define SIG_BIT_ONE    SIGUSR1 // Client sends SIGUSR1 for bit '1'
 # define SIG_BIT_ZERO   SIGUSR2 // Client sends SIGUSR2 for bit '0'
-# define SIG_ACK        SIGUSR1 // Server sends SIGUSR1 back as ACK (for bonus)
+// ACKs (bonus) are real-time signals: they queue up at the client, so the
+// ACKs of several servers answering at once are never merged into one
+# define SIG_ACK        (SIGRTMIN + 1) // ACK of a single server
+# define SIG_GROUP_ACK  SIGRTMIN // ACK of a server in a broadcast group
+// ACKs are sent with sigqueue() and carry a receipt of what the server got
+// (see t_receipt). Clients wait that long for them, unless the environment
+// variable MINITALK_ACK_TIMEOUT_MS says otherwise.
+# define ACK_TIMEOUT_MS		5000
+# define ACK_TIMEOUT_ENV	"MINITALK_ACK_TIMEOUT_MS"
+
+// Message storage kept between messages; larger buffers are released
+# define MESSAGE_KEEP_CAPACITY 4096
 
-# define INITIAL_BUFFER_CAPACITY 64
+// Client delay between two signals (microseconds)
+# define BIT_DELAY_US 500
 
 // --- Bonus Mode Definition ---
 # ifndef BONUSB
 #  define BONUSB 0
 # endif
 
+// --- Forward Error Correction Mode (make fec) ---
+// Bytes are sent as interleaved SECDED(8,4) blocks (see src/fec.c), so the
+// server can repair single lost or flipped signals without any ACK.
+# ifndef FECB
+#  define FECB 0
+# endif
+# define FEC_BLOCK_BYTES		4
+# define FEC_BLOCK_CODEWORDS	8 // Two codewords (nibbles) per byte
+# define FEC_BLOCK_BITS			64 // Signals per block on the wire
+# define FEC_BIT_DELAY_US		100 // Client delay between signals of a block
+# define FEC_BLOCK_GAP_US		3000 // Client pause after every block
+# define FEC_GAP_US				2000 // Server: silence that marks a block pause
+# define FEC_IDLE_US			20000 // Server: silence that ends a message
+
+// --- Threaded Server (server -t <workers>) ---
+// One dispatcher thread takes the signals with sigwaitinfo() and hands them
+// to worker threads sharded by sender PID (see src/server_threads.c).
+# define SERVER_MAX_WORKERS		64
+# define EVENT_QUEUE_SIZE		4096 // Signals buffered per worker (power of 2)
+# define CACHE_LINE				64
+# define SESSION_IDLE_MS		2000 // Silence that ends an unfinished session
+
+// --- Broadcast Groups (server -g <pgid>, client -g <pgid>) ---
+// Servers join one process group and the client signals all of them with
+// a single kill(-pgid, ...) per bit (see src/client_group.c).
+# define GROUP_MAX_MEMBERS		256
+
+// --- Striping (client -s <pid>... <message>, tools/merge.c) ---
+// The message is cut into one stripe per server, each sent by its own
+// forked sender as "@stripe:<pid>.<stamp>:<seq>:<count>:<len>:<bytes>".
+# define STRIPE_TAG				"@stripe:"
+# define STRIPE_MAX_PIDS		64
+
+// --- Server Registry (server -r, client -k <key> | -l) ---
+// Each registered server keeps a file named after its PID in the registry
+// directory ($MINITALK_REGISTRY overrides), holding its load figure. The
+// server holds a flock() on it while it runs; an unlocked entry is stale.
+# define REGISTRY_DIR			"/tmp/minitalk-registry"
+# define REGISTRY_PATH_MAX		256
+# define REGISTRY_FIELD			10
+# define REGISTRY_RECORD		22 // "<busy:10> <messages:10>\n"
+# define REGISTRY_VNODES		64 // Points of each server on the hash ring
+
+// --- Pipelined Sessions (client -p, mt_session_begin) ---
+// A wire message starting with PIPELINE_OPEN carries a stream of messages,
+// each ended by PIPELINE_SEP; its NUL ends the session. The server ACKs
+// every PIPELINE_BATCH messages, and once more at the end.
+# define PIPELINE_OPEN			0x01 // ASCII SOH
+# define PIPELINE_SEP			0x1E // ASCII RS
+# define PIPELINE_BATCH			16
+
+// --- Client Library (libminitalk.a, see includes/libminitalk.h) ---
+# if FECB
+#  define MT_TICK_US			FEC_BIT_DELAY_US // Async sender: a bit per tick
+# else
+#  define MT_TICK_US			BIT_DELAY_US
+# endif
+# define MT_ASYNC_RETRIES		2 // Resends of a message left unacknowledged
+
 /* --- Struct Definition --- */
+// Receipt of a message: its length and CRC-32C (ft_crc32), terminator
+// excluded. A server keeps one per message it receives and returns it in
+// the payload of its ACK, where the client compares it with its own.
+typedef struct s_receipt
+{
+	uint32_t	len;
+	uint32_t	crc;
+}	t_receipt;
+
+// What the classic server assembles from its client's bytes. Kept out of
+// the volatile g_state: it is only touched with the transport signals
+// blocked (inside the handler, or from the main loop by fec_flush_stale),
+// so no access can interleave with the handler's.
+typedef struct s_server_text
+{
+	t_strbuf	message;
+	t_receipt	receipt;
+}	t_server_text;
+
 typedef struct s_server_state
 {
-	unsigned char	char_in_progress;
-	int				bits_received;
-	char			*message_buffer;
-	size_t			message_len;
-	size_t			buffer_capacity;
-	pid_t			active_client_pid;
+	unsigned char		char_in_progress;
+	int					bits_received;
+	pid_t				active_client_pid;
+	unsigned long long	fec_stream;
+	int					fec_bits;
+	int					fec_gap_at;
+	long				fec_last_us;
+	int					fec_dropping;
+	int					ack_signal;
+	int					pipelined;
+	long				pipeline_count;
+	int					registry_fd;
+	_Atomic long		registry_busy;
+	_Atomic long		registry_done;
+	char				registry_path[REGISTRY_PATH_MAX];
 }	t_server_state;
 
+// Command line of the server
+typedef struct s_server_opts
+{
+	int		workers;
+	int		grouped;
+	pid_t	group;
+	int		registered;
+}	t_server_opts;
+
+// Servers found in the target process group when a broadcast starts
+typedef struct s_group
+{
+	pid_t	pgid;
+	int		count;
+	pid_t	members[GROUP_MAX_MEMBERS];
+	char	acked[GROUP_MAX_MEMBERS];
+}	t_group;
+
+// One striped send. The client's PID and the CLOCK_MONOTONIC time it
+// started (ns) identify it, so tools/merge never mixes up the stripes of
+// two sends once the PID is reused.
+typedef struct s_stripe_send
+{
+	pid_t		pid;
+	uint64_t	stamp;
+	int			count;
+	size_t		len; // Of the whole message
+}	t_stripe_send;
+
+// Ring buffer from the dispatcher (only producer) to one worker (only
+// consumer). An event is the sender's PID shifted left once, plus the bit.
+// The worker raises `sleeping` before it blocks on `wake`, so the
+// dispatcher only posts the semaphore when there is someone to wake.
+typedef struct s_evqueue
+{
+	_Atomic size_t	head;
+	char			head_pad[CACHE_LINE - sizeof(size_t)];
+	_Atomic size_t	tail;
+	_Atomic int		sleeping;
+	sem_t			wake;
+	uint64_t		events[EVENT_QUEUE_SIZE];
+}	t_evqueue;
+
+// Message being received from one client, owned by a single worker.
+// Sessions are found by PID in the worker's map and also chained in a
+// list, which the idle sweep walks (see server_sweep.c).
+typedef struct s_session
+{
+	pid_t				pid;
+	unsigned char		char_in_progress;
+	int					bits_received;
+	t_strbuf			message;
+	t_receipt			receipt;
+	int					pipelined;
+	long				frames;
+	long				last_ms;
+	struct s_session	*prev;
+	struct s_session	*next;
+}	t_session;
+
+typedef struct s_worker
+{
+	pthread_t		thread;
+	t_hmap			sessions;
+	t_session		*live;
+	pthread_mutex_t	*out_lock;
+	t_evqueue		queue;
+}	t_worker;
+
+// Server choice of a client while it walks the registry: the server
+// nearest after the key on the hash ring (-k), or the least loaded (-l)
+typedef struct s_registry_pick
+{
+	const char	*key;
+	uint32_t	key_hash;
+	pid_t		pid;
+	uint32_t	distance;
+	long		busy;
+	long		done;
+}	t_registry_pick;
+
+// Connection of libminitalk.a to one server
+// `frames` counts the messages of the current session, -1 outside one;
+// `receipt` covers the session so far
+struct s_mt_conn
+{
+	pid_t		pid;
+	long		frames;
+	t_receipt	receipt;
+};
+
+// One message of the async sender. `word` holds the `nbits` bits still to
+// send of the current unit (a byte, or a FEC block), `pos` is where the
+// next unit starts. Times are counted in ticks of the loop's timer.
+typedef struct s_mt_xfer
+{
+	long				id;
+	pid_t				pid;
+	unsigned char		*buf;
+	size_t				len;
+	size_t				pos;
+	unsigned long long	word;
+	int					nbits;
+	long				resume;
+	long				deadline;
+	int					retries;
+	t_receipt			receipt;
+}	t_mt_xfer;
+
+// Transfers stay in queue order, so the first one found for a PID is the
+// one in flight and the next ones wait for it to end.
+struct s_mt_loop
+{
+	int			timer_fd;
+	int			signal_fd;
+	long		now;
+	long		ack_ticks;
+	long		next_id;
+	int			closing;
+	t_mt_done	done;
+	void		*arg;
+	t_mt_xfer	*xfers;
+	size_t		count;
+	size_t		cap;
+};
+
+// While a connection or an async loop is open, the ACK signals stay blocked
+// so they can be collected with sigtimedwait() or a signalfd. `blocked`
+// holds the ones the library blocked itself, unblocked with the last hold.
+typedef struct s_ack_holds
+{
+	int			holds;
+	sigset_t	blocked;
+}	t_ack_holds;
+
 /* --- Global Variable Declaration --- */
 // The server's state, declared as 'extern' so server_utils.c
 // can access it.
@@ -69,6 +316,82 @@ extern volatile t_server_state	g_state;
 /* --- Server Utility Function Prototypes --- */
 // These functions are now public to the server module
 // (defined in server_utils.c)
+t_server_text	*server_text(void);
 int		init_server_state(pid_t client_pid);
 int		append_char_to_buffer(unsigned char c);
+void	handle_completed_byte(void);
+void	server_print_message(t_strbuf *message);
+void	server_send_ack(pid_t client_pid, const t_receipt *receipt);
+
+/* --- Pipelined Sessions (server_pipeline.c) --- */
+int		pipeline_byte(unsigned char c);
+int		session_pipeline_byte(t_worker *worker, t_session *session,
+			unsigned char c);
+
+/* --- Server Options (server_args.c) --- */
+int		parse_server_args(int argc, char **argv, t_server_opts *opts);
+int		join_server_group(pid_t pgid);
+
+/* --- Server Registry (registry.c, server_registry.c, client_registry.c) --- */
+const char	*registry_dir(void);
+int			registry_path(char *path, const char *name);
+uint32_t	ring_hash(uint64_t x);
+uint32_t	ring_distance(pid_t pid, uint32_t key_hash);
+int			registry_open(void);
+void		registry_update(int busy_delta, int done_delta);
+pid_t		registry_target(int argc, char **argv);
+
+/* --- Threaded Server (server_threads.c, server_evq.c, server_session.c) --- */
+int		run_threaded_server(int workers);
+void	evq_push(t_evqueue *queue, uint64_t event);
+int		evq_pop(t_evqueue *queue, uint64_t *event, int timed);
+void	session_receive_bit(t_worker *worker, pid_t pid, int bit);
+void	session_free(t_worker *worker, t_session *session);
+
+/* --- Idle Sessions (server_sweep.c) --- */
+long	session_clock_ms(void);
+void	session_drop(t_worker *worker, t_session *session);
+void	session_sweep(t_worker *worker);
+
+/* --- Forward Error Correction (fec.c, server_fec.c) --- */
+unsigned long long	fec_encode_block(const unsigned char *data);
+int					fec_decode_block(unsigned long long stream,
+						unsigned char *data);
+int					fec_repair_block(unsigned long long partial,
+						unsigned char *data);
+void				fec_receive_bit(int bit);
+void				fec_flush_stale(long idle_us);
+
+/* --- Client (client.c, client_send.c, client_stripe.c) --- */
+int		send_raw(pid_t server_pid, const void *buf, size_t len);
+int		send_bytes(pid_t server_pid, const void *buf, size_t len);
+void	send_message(pid_t server_pid, const char *message);
+int		send_striped(int count, char **pid_args, const char *message);
+
+/* --- Pipelined Client (client_pipeline.c) --- */
+int		send_pipelined(int argc, char **argv);
+
+/* --- Client Library (mt.c, mt_signals.c) --- */
+void	ack_set(sigset_t *set);
+int		acks_hold(void);
+int		wait_ack(pid_t pid, const t_receipt *sent, uint64_t *got);
+void	acks_release(void);
+
+/* --- Async Client Library (mt_async.c, mt_async_loop.c, mt_async_ack.c) --- */
+void	mt_finish(t_mt_loop *loop, size_t i, int error);
+void	mt_read_acks(t_mt_loop *loop);
+
+/* --- Receipts and ACK deadlines (receipt.c, ack_time.c) --- */
+void		receipt_init(t_receipt *receipt, const void *buf, size_t len);
+void		receipt_add(t_receipt *receipt, const void *buf, size_t len);
+uint64_t	receipt_value(const t_receipt *receipt);
+uint64_t	receipt_received(const siginfo_t *info);
+long		ack_timeout_ms(void);
+void		ack_deadline(struct timespec *deadline);
+int			ack_time_left(const struct timespec *deadline,
+				struct timespec *left);
+
+/* --- Broadcast Client (client_group.c, client_group_ack.c) --- */
+int		group_open(t_group *group, pid_t pgid);
+int		wait_for_group_acks(t_group *group, const char *message);
 #endif
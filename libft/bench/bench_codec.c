@@ -0,0 +1,298 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_codec.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:06:34 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:06:34 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * Equivalence and timing bench for the CRC-32C and UTF-8 kernels.
+ *
+ * ft_crc32 is checked against a bit-at-a-time reference and the standard
+ * check value, for every length and alignment up to BENCH_MAX_LEN and for
+ * chained calls. ft_utf8_valid is checked against an independent decoder on
+ * random text mixing every encoding length, with and without corruption,
+ * over every prefix so that truncated sequences are covered. The timing
+ * table gives GB/s for each kernel at the CPU level in use.
+ *
+ * Usage: make -C libft bench    (or ./bench/bench_codec [--check])
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libft.h"
+#include "ft_simd.h"
+
+#define BENCH_MAX_LEN	512
+#define BENCH_ALIGNS	16
+#define BENCH_TEXT		4096
+#define BENCH_BYTES		(256L << 20)
+
+typedef struct s_codec_impl
+{
+	const char	*name;
+	int			available;
+	uint32_t	(*crc32)(uint32_t crc, const unsigned char *s, size_t n);
+	int			(*utf8_valid)(const unsigned char *s, size_t n);
+}	t_codec_impl;
+
+static volatile size_t	g_sink;
+
+static uint32_t	ref_crc32(uint32_t crc, const unsigned char *s, size_t n)
+{
+	int	k;
+
+	crc = ~crc;
+	while (n-- > 0)
+	{
+		crc ^= *s++;
+		k = -1;
+		while (++k < 8)
+			crc = (crc >> 1) ^ (0x82F63B78u & -(crc & 1));
+	}
+	return (~crc);
+}
+
+/* Decodes one code point and checks its range; returns its length or 0 */
+static size_t	ref_utf8_one(const unsigned char *s, size_t n)
+{
+	static const uint32_t	mins[] = {0, 0x80, 0x800, 0x10000};
+	static const uint32_t	masks[] = {0x7F, 0x1F, 0x0F, 0x07};
+	uint32_t				cp;
+	size_t					len;
+	size_t					i;
+
+	if ((s[0] >= 0x80 && s[0] < 0xC0) || s[0] >= 0xF8)
+		return (0);
+	len = 1 + (s[0] >= 0xC0) + (s[0] >= 0xE0) + (s[0] >= 0xF0);
+	if (n < len)
+		return (0);
+	cp = s[0] & masks[len - 1];
+	i = 0;
+	while (++i < len)
+	{
+		if ((s[i] & 0xC0) != 0x80)
+			return (0);
+		cp = cp << 6 | (s[i] & 0x3F);
+	}
+	if (cp < mins[len - 1] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+		return (0);
+	return (len);
+}
+
+static int	ref_utf8_valid(const unsigned char *s, size_t n)
+{
+	size_t	len;
+
+	while (n > 0)
+	{
+		len = ref_utf8_one(s, n);
+		if (len == 0)
+			return (0);
+		s += len;
+		n -= len;
+	}
+	return (1);
+}
+
+static int	load_impls(t_codec_impl *impls)
+{
+	int	count;
+
+	count = 0;
+	impls[count++] = (t_codec_impl){"word", 1, ft_crc32_table,
+		ft_utf8_valid_word};
+#if FT_X86_SIMD
+
+	impls[count++] = (t_codec_impl){"sse2", 1, ft_crc32_table,
+		ft_utf8_valid_sse2};
+	impls[count++] = (t_codec_impl){"sse4.2", __builtin_cpu_supports("sse4.2"),
+		ft_crc32_sse42, ft_utf8_valid_sse2};
+	impls[count++] = (t_codec_impl){"avx2", __builtin_cpu_supports("avx2"),
+		ft_crc32_sse42, ft_utf8_valid_avx2};
+#endif
+
+	return (count);
+}
+
+/* The kernels work on the raw register; wrap them like ft_crc32 does */
+static uint32_t	kernel_crc(const t_codec_impl *impl, uint32_t crc,
+		const unsigned char *s, size_t n)
+{
+	return (~impl->crc32(~crc, s, n));
+}
+
+static int	check_crc(const t_codec_impl *impl, unsigned char *buf)
+{
+	size_t		len;
+	size_t		align;
+	uint32_t	want;
+	uint32_t	head;
+
+	if (kernel_crc(impl, 0, (const unsigned char *)"123456789", 9)
+		!= 0xE3069283u)
+	{
+		fprintf(stderr, "bench: %s crc32 check value\n", impl->name);
+		return (1);
+	}
+	len = 0;
+	while (len <= BENCH_MAX_LEN)
+	{
+		align = 0;
+		while (align < BENCH_ALIGNS)
+		{
+			want = ref_crc32(0, buf + align, len);
+			head = kernel_crc(impl, 0, buf + align, len / 3);
+			if (kernel_crc(impl, 0, buf + align, len) != want
+				|| kernel_crc(impl, head, buf + align + len / 3,
+					len - len / 3) != want)
+			{
+				fprintf(stderr, "bench: %s crc32 len=%zu align=%zu\n",
+					impl->name, len, align);
+				return (1);
+			}
+			align++;
+		}
+		len++;
+	}
+	return (0);
+}
+
+static size_t	encode(uint32_t cp, unsigned char *out)
+{
+	if (cp < 0x80)
+		out[0] = cp;
+	else if (cp < 0x800)
+		out[0] = 0xC0 | cp >> 6;
+	else if (cp < 0x10000)
+		out[0] = 0xE0 | cp >> 12;
+	else
+		out[0] = 0xF0 | cp >> 18;
+	if (cp >= 0x10000)
+		out[1] = 0x80 | (cp >> 12 & 0x3F);
+	if (cp >= 0x800)
+		out[1 + (cp >= 0x10000)] = 0x80 | (cp >> 6 & 0x3F);
+	if (cp >= 0x80)
+		out[1 + (cp >= 0x800) + (cp >= 0x10000)] = 0x80 | (cp & 0x3F);
+	return (1 + (cp >= 0x80) + (cp >= 0x800) + (cp >= 0x10000));
+}
+
+/*
+ * Random text of mostly ASCII runs with 2- to 4-byte code points mixed in,
+ * optionally with one byte overwritten by a random value.
+ */
+static size_t	make_text(unsigned char *buf, size_t size, int corrupt)
+{
+	static const uint32_t	spans[] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x800,
+		0x10000, 0x110000};
+	uint32_t				cp;
+	size_t					len;
+
+	len = 0;
+	while (len + 4 <= size)
+	{
+		cp = rand() % spans[rand() % 8];
+		if (cp >= 0xD800 && cp <= 0xDFFF)
+			cp = 'x';
+		len += encode(cp, buf + len);
+	}
+	if (corrupt && len > 0)
+		buf[rand() % len] = rand() & 0xFF;
+	return (len);
+}
+
+/* Every prefix of every text, so truncated sequences are covered too */
+static int	check_utf8(const t_codec_impl *impl, unsigned char *buf)
+{
+	size_t	len;
+	size_t	n;
+	int		round;
+
+	round = 0;
+	while (round < 200)
+	{
+		len = make_text(buf, 160, round & 1);
+		n = 0;
+		while (n <= len)
+		{
+			if (impl->utf8_valid(buf, n) != ref_utf8_valid(buf, n))
+			{
+				fprintf(stderr, "bench: %s utf8 round=%d n=%zu\n",
+					impl->name, round, n);
+				return (1);
+			}
+			n++;
+		}
+		round++;
+	}
+	return (0);
+}
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+static void	time_impl(const t_codec_impl *impl, unsigned char *buf,
+		size_t len)
+{
+	double	start;
+	double	crc_ns;
+	long	reps;
+	long	i;
+
+	reps = BENCH_BYTES / (long)len;
+	i = 0;
+	start = now_ns();
+	while (i++ < reps)
+		g_sink += impl->crc32(0, buf, len);
+	crc_ns = now_ns() - start;
+	i = 0;
+	start = now_ns();
+	while (i++ < reps)
+		g_sink += impl->utf8_valid(buf, len);
+	printf("%-8s %12.2f %12.2f\n", impl->name,
+		reps * (double)len / crc_ns, reps * (double)len / (now_ns() - start));
+}
+
+int	main(int argc, char **argv)
+{
+	t_codec_impl	impls[4];
+	unsigned char	buf[BENCH_TEXT];
+	size_t			len;
+	int				count;
+	int				k;
+
+	srand(42);
+	k = -1;
+	while (++k < BENCH_TEXT)
+		buf[k] = rand();
+	count = load_impls(impls);
+	k = -1;
+	while (++k < count)
+	{
+		if (impls[k].available && (check_crc(&impls[k], buf)
+				|| check_utf8(&impls[k], buf)))
+			return (EXIT_FAILURE);
+	}
+	printf("crc32/utf8 kernels match the references (libft uses %s)\n",
+		ft_cpu_level_name(ft_cpu_level()));
+	if (argc > 1 && ft_strncmp(argv[1], "--check", 8) == 0)
+		return (EXIT_SUCCESS);
+	len = make_text(buf, BENCH_TEXT, 0);
+	printf("\n%-8s %12s %12s   (%zu bytes of mixed UTF-8)\n", "kernel",
+		"crc32 GB/s", "utf8 GB/s", len);
+	k = -1;
+	while (++k < count)
+		if (impls[k].available)
+			time_impl(&impls[k], buf, len);
+	return (EXIT_SUCCESS);
+}
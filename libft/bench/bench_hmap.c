@@ -0,0 +1,320 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_hmap.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:35:28 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:35:28 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * Equivalence and timing bench for t_hmap.
+ *
+ * Random put/get/del sequences on integer and byte-string maps are checked
+ * against a plain array indexed by key. The timing table compares t_hmap
+ * with a textbook linear-probing table (tombstone deletion, rehash of the
+ * whole table when it fills up) on BENCH_KEYS random 64-bit keys: inserts,
+ * hits, misses and delete/insert churn in ns/op, plus the slowest single
+ * insert, which is where the incremental resize shows.
+ *
+ * Usage: make -C libft bench    (or ./bench/bench_hmap [--check])
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libft.h"
+#include "ft_hash.h"
+
+#define BENCH_SPACE	4096
+#define BENCH_OPS	300000
+#define BENCH_KEYS	1000000
+
+#define LP_EMPTY	0
+#define LP_FULL		1
+#define LP_TOMB		2
+
+typedef struct s_lp_slot
+{
+	uint64_t	key;
+	void		*value;
+	int			state;
+}	t_lp_slot;
+
+typedef struct s_lp
+{
+	t_lp_slot	*slots;
+	size_t		mask;
+	size_t		used;
+}	t_lp;
+
+static volatile size_t	g_sink;
+
+static t_lp_slot	*lp_probe(t_lp *lp, uint64_t key, int for_insert)
+{
+	t_lp_slot	*tomb;
+	size_t		i;
+
+	tomb = NULL;
+	i = ft_hash_mix(key) & lp->mask;
+	while (lp->slots[i].state != LP_EMPTY)
+	{
+		if (lp->slots[i].state == LP_FULL && lp->slots[i].key == key)
+			return (&lp->slots[i]);
+		if (lp->slots[i].state == LP_TOMB && !tomb)
+			tomb = &lp->slots[i];
+		i = (i + 1) & lp->mask;
+	}
+	if (!for_insert)
+		return (NULL);
+	if (tomb)
+		return (tomb);
+	return (&lp->slots[i]);
+}
+
+static void	lp_put(t_lp *lp, uint64_t key, void *value);
+
+/* Rehashes everything into a table twice as large (tombstones dropped) */
+static void	lp_grow(t_lp *lp)
+{
+	t_lp	old;
+	size_t	i;
+
+	old = *lp;
+	lp->mask = (old.mask + 1) * 2 - 1;
+	if (!old.slots)
+		lp->mask = 15;
+	lp->slots = calloc(lp->mask + 1, sizeof(t_lp_slot));
+	lp->used = 0;
+	i = 0;
+	while (old.slots && i <= old.mask)
+	{
+		if (old.slots[i].state == LP_FULL)
+			lp_put(lp, old.slots[i].key, old.slots[i].value);
+		i++;
+	}
+	free(old.slots);
+}
+
+static void	lp_put(t_lp *lp, uint64_t key, void *value)
+{
+	t_lp_slot	*slot;
+
+	if (!lp->slots || (lp->used + 1) * 8 > (lp->mask + 1) * 7)
+		lp_grow(lp);
+	slot = lp_probe(lp, key, 1);
+	if (slot->state == LP_EMPTY)
+		lp->used++;
+	slot->state = LP_FULL;
+	slot->key = key;
+	slot->value = value;
+}
+
+static int	lp_del(t_lp *lp, uint64_t key)
+{
+	t_lp_slot	*slot;
+
+	slot = lp_probe(lp, key, 0);
+	if (!slot)
+		return (0);
+	slot->state = LP_TOMB;
+	return (1);
+}
+
+/* One random operation on both maps and the model; returns 1 on mismatch */
+static int	check_op(t_hmap *ints, t_hmap *strs, void **model, uint64_t key)
+{
+	char	name[FT_FMT_BUFSIZE];
+	size_t	len;
+	void	**got;
+	void	**got_s;
+	int		op;
+
+	len = ft_fmt_u64(name, key * 7919);
+	op = rand() % 3;
+	if (op == 0)
+	{
+		model[key] = (void *)(uintptr_t)(rand() + 1);
+		return (ft_hmap_put(ints, key, model[key])
+			|| ft_hmap_put_bytes(strs, name, len, model[key]));
+	}
+	if (op == 1)
+	{
+		got = ft_hmap_get(ints, key);
+		got_s = ft_hmap_get_bytes(strs, name, len);
+		return ((got == NULL) != (model[key] == NULL)
+			|| (got_s == NULL) != (model[key] == NULL)
+			|| (got && (*got != model[key] || *got_s != model[key])));
+	}
+	op = (model[key] != NULL);
+	model[key] = NULL;
+	return (ft_hmap_del(ints, key, NULL) != op
+		|| ft_hmap_del_bytes(strs, name, len, NULL) != op);
+}
+
+static size_t	count_live(void **model)
+{
+	size_t	live;
+	size_t	key;
+
+	live = 0;
+	key = 0;
+	while (key < BENCH_SPACE)
+		live += (model[key++] != NULL);
+	return (live);
+}
+
+/* Key ranges shrink and grow so the maps keep resizing mid-sequence */
+static int	check_maps(void)
+{
+	static void	*model[BENCH_SPACE];
+	t_hmap		ints;
+	t_hmap		strs;
+	int			i;
+
+	ft_hmap_init(&ints, 0);
+	ft_hmap_init(&strs, 1);
+	i = 0;
+	while (i < BENCH_OPS && !check_op(&ints, &strs, model,
+			rand() % (BENCH_SPACE >> (i / 50000 % 4))))
+		i++;
+	if (i == BENCH_OPS && (ft_hmap_size(&ints) != count_live(model)
+			|| ft_hmap_size(&strs) != count_live(model)))
+		i = -1;
+	ft_hmap_free(&ints, NULL);
+	ft_hmap_free(&strs, NULL);
+	if (i == BENCH_OPS)
+		return (0);
+	fprintf(stderr, "bench: t_hmap differs from the model at op %d\n", i);
+	return (1);
+}
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+static void	hm_put(void *map, uint64_t key)
+{
+	ft_hmap_put(map, key, map);
+}
+
+static int	hm_has(void *map, uint64_t key)
+{
+	return (ft_hmap_get(map, key) != NULL);
+}
+
+static void	hm_del(void *map, uint64_t key)
+{
+	ft_hmap_del(map, key, NULL);
+}
+
+static void	lp_put_key(void *lp, uint64_t key)
+{
+	lp_put(lp, key, lp);
+}
+
+static int	lp_has(void *lp, uint64_t key)
+{
+	return (lp_probe(lp, key, 0) != NULL);
+}
+
+static void	lp_del_key(void *lp, uint64_t key)
+{
+	lp_del(lp, key);
+}
+
+typedef struct s_impl
+{
+	const char	*name;
+	void		*map;
+	void		(*put)(void *, uint64_t);
+	int			(*has)(void *, uint64_t);
+	void		(*del)(void *, uint64_t);
+}	t_impl;
+
+/* Inserts keys[0..n) timing each call; returns the slowest one */
+static double	fill(const t_impl *impl, const uint64_t *keys, size_t n)
+{
+	double	worst;
+	double	start;
+	double	took;
+	size_t	i;
+
+	worst = 0;
+	i = 0;
+	while (i < n)
+	{
+		start = now_ns();
+		impl->put(impl->map, keys[i++]);
+		took = now_ns() - start;
+		if (took > worst)
+			worst = took;
+	}
+	return (worst);
+}
+
+/* keys[0..n) are inserted, keys[n..2n) are never present */
+static void	time_impl(const t_impl *impl, const uint64_t *keys, size_t n)
+{
+	double	t[5];
+	size_t	i;
+
+	t[0] = now_ns();
+	t[4] = fill(impl, keys, n);
+	t[1] = now_ns();
+	i = 0;
+	while (i < n)
+		g_sink += impl->has(impl->map, keys[i++]);
+	t[2] = now_ns();
+	while (i < 2 * n)
+		g_sink += impl->has(impl->map, keys[i++]);
+	t[3] = now_ns();
+	i = 0;
+	while (i < n)
+	{
+		impl->del(impl->map, keys[i]);
+		impl->put(impl->map, keys[n + i++]);
+	}
+	printf("%-14s %9.1f %9.1f %9.1f %9.1f %11.0f\n", impl->name,
+		(t[1] - t[0]) / n, (t[2] - t[1]) / n, (t[3] - t[2]) / n,
+		(now_ns() - t[3]) / n, t[4] / 1e3);
+}
+
+int	main(int argc, char **argv)
+{
+	uint64_t	*keys;
+	t_hmap		map;
+	t_lp		lp;
+	size_t		i;
+
+	srand(42);
+	if (check_maps())
+		return (EXIT_FAILURE);
+	printf("t_hmap matches the model on int and byte keys\n");
+	if (argc > 1 && ft_strncmp(argv[1], "--check", 8) == 0)
+		return (EXIT_SUCCESS);
+	keys = malloc(2 * BENCH_KEYS * sizeof(uint64_t));
+	if (!keys)
+		return (EXIT_FAILURE);
+	i = 0;
+	while (i < 2 * BENCH_KEYS)
+		keys[i++] = (uint64_t)rand() << 32 ^ (uint64_t)rand() << 16 ^ rand();
+	ft_hmap_init(&map, 0);
+	ft_bzero(&lp, sizeof(lp));
+	printf("\n%-14s %9s %9s %9s %9s %11s   (ns/op, %d keys)\n", "map",
+		"insert", "hit", "miss", "churn", "worst us", BENCH_KEYS);
+	time_impl(&(t_impl){"t_hmap", &map, hm_put, hm_has, hm_del},
+		keys, BENCH_KEYS);
+	time_impl(&(t_impl){"linear probe", &lp, lp_put_key, lp_has, lp_del_key},
+		keys, BENCH_KEYS);
+	ft_hmap_free(&map, NULL);
+	free(lp.slots);
+	free(keys);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,896 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_libc.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:44:45 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:51:05 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * libft against glibc: every memory, string, conversion and formatting
+ * routine that has a libc counterpart, timed side by side.
+ *
+ * Each routine runs over a sweep of lengths; successive calls rotate
+ * through four source and destination misalignments, and the search and
+ * compare routines are run both on a full scan and with the hit or the
+ * difference half-way ("/half" rows). Routines without a fixed input length
+ * (conversions, formatting) are timed on a mix of values. The table shows
+ * ns/op and bytes/cycle for both sides; rows where libft takes more than
+ * twice as long as libc are flagged and listed again at the end, worst
+ * first. Cycles are measured with a dependent add chain, so they count
+ * core clocks, not TSC ticks.
+ *
+ * Where libc has no direct equivalent the closest idiom is timed instead
+ * (e.g. ft_strlcpy against strlen + memcpy, ft_split against strtok_r on a
+ * copy); ft_split_flat, ft_crc32 and ft_utf8_valid have their own benches.
+ * The output routines write to /dev/null: ft_printf and printf through
+ * fd 1, which is pointed there while the table goes to a copy of the
+ * original stdout. printf is then fully buffered, as in any redirected run.
+ *
+ * Usage: make -C libft bench    (or ./bench/bench_libc [--check])
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <ctype.h>
+#include <unistd.h>
+#include "libft.h"
+#include "ft_printf.h"
+
+#define BENCH_MAX_LEN	65536
+#define BENCH_SLACK		64
+#define BENCH_BYTES		(32L << 20)
+#define BENCH_MIN_OPS	20000L
+#define BENCH_FLAG		2.0
+#define BENCH_MAX_FLAGS	64
+
+typedef size_t	(*t_op)(size_t len, size_t k);
+
+typedef struct s_routine
+{
+	const char	*name;
+	const char	*libc;
+	t_op		ft;
+	t_op		ref;
+	int			sized;
+}	t_routine;
+
+typedef struct s_flag
+{
+	const char	*name;
+	size_t		len;
+	double		ratio;
+}	t_flag;
+
+static const size_t	g_lens[] = {1, 8, 32, 128, 512, 4096, BENCH_MAX_LEN, 0};
+static const size_t	g_src_offs[4] = {0, 1, 5, 13};
+static const size_t	g_dst_offs[4] = {0, 3, 8, 11};
+static char			g_src[4][BENCH_MAX_LEN + BENCH_SLACK];
+static char			g_dst[4][2 * BENCH_MAX_LEN + BENCH_SLACK];
+static int			g_devnull;
+static int			g_out;
+static volatile size_t	g_sink;
+static t_flag			g_flags[BENCH_MAX_FLAGS];
+static size_t			g_nflags;
+
+static char	*src(size_t k)
+{
+	return (g_src[k & 3] + g_src_offs[k & 3]);
+}
+
+static char	*dst(size_t k)
+{
+	return (g_dst[k & 3] + g_dst_offs[k & 3]);
+}
+
+/*
+ * Source and destination k hold the same letters at different alignments,
+ * terminated at len. For the /half rows the source gets "#@#@" at len / 2,
+ * which the search rows look for and the compare rows trip over.
+ */
+static void	prepare(size_t len, int half)
+{
+	size_t	k;
+	size_t	j;
+
+	k = 0;
+	while (k < 4)
+	{
+		j = 0;
+		while (j < BENCH_MAX_LEN + BENCH_SLACK - 16)
+		{
+			src(k)[j] = 'a' + (j * 7 + k) % 26;
+			dst(k)[j] = src(k)[j];
+			j++;
+		}
+		src(k)[len] = '\0';
+		dst(k)[len] = '\0';
+		j = 0;
+		while (half && j < 4 && len / 2 + j < len)
+		{
+			src(k)[len / 2 + j] = "#@#@"[j];
+			j++;
+		}
+		k++;
+	}
+}
+
+/* Position of p in source k, so that results compare across sides */
+static size_t	at(const void *p, size_t k)
+{
+	if (!p)
+		return ((size_t)-1);
+	return ((const char *)p - src(k));
+}
+
+static size_t	sign(int r)
+{
+	return ((r > 0) - (r < 0) + 1);
+}
+
+/* Lengths of malloc'ed results, which are then freed */
+static size_t	freed(char *s)
+{
+	size_t	len;
+
+	if (!s)
+		return ((size_t)-1);
+	len = strlen(s);
+	free(s);
+	return (len);
+}
+
+/* --- memory --- */
+
+static size_t	ft_cpy(size_t len, size_t k)
+{
+	ft_memcpy(dst(k), src(k), len);
+	return ((unsigned char)dst(k)[len - 1]);
+}
+
+static size_t	lc_cpy(size_t len, size_t k)
+{
+	memcpy(dst(k), src(k), len);
+	return ((unsigned char)dst(k)[len - 1]);
+}
+
+static size_t	ft_move(size_t len, size_t k)
+{
+	ft_memmove(dst(k) + 1, dst(k), len);
+	return ((unsigned char)dst(k)[len]);
+}
+
+static size_t	lc_move(size_t len, size_t k)
+{
+	memmove(dst(k) + 1, dst(k), len);
+	return ((unsigned char)dst(k)[len]);
+}
+
+static size_t	ft_set(size_t len, size_t k)
+{
+	ft_memset(dst(k), 'x', len);
+	return ((unsigned char)dst(k)[len - 1]);
+}
+
+static size_t	lc_set(size_t len, size_t k)
+{
+	memset(dst(k), 'x', len);
+	return ((unsigned char)dst(k)[len - 1]);
+}
+
+static size_t	ft_zero(size_t len, size_t k)
+{
+	ft_bzero(dst(k), len);
+	return ((unsigned char)dst(k)[len - 1]);
+}
+
+static size_t	lc_zero(size_t len, size_t k)
+{
+	bzero(dst(k), len);
+	return ((unsigned char)dst(k)[len - 1]);
+}
+
+static size_t	ft_cal(size_t len, size_t k)
+{
+	char	*p;
+	size_t	r;
+
+	(void)k;
+	p = ft_calloc(len, 1);
+	if (!p)
+		return ((size_t)-1);
+	r = (unsigned char)p[0] + (unsigned char)p[len - 1];
+	free(p);
+	return (r);
+}
+
+static size_t	lc_cal(size_t len, size_t k)
+{
+	char	*p;
+	size_t	r;
+
+	(void)k;
+	p = calloc(len, 1);
+	if (!p)
+		return ((size_t)-1);
+	r = (unsigned char)p[0] + (unsigned char)p[len - 1];
+	free(p);
+	return (r);
+}
+
+static size_t	ft_chr(size_t len, size_t k)
+{
+	return (at(ft_memchr(src(k), '#', len), k));
+}
+
+static size_t	lc_chr(size_t len, size_t k)
+{
+	return (at(memchr(src(k), '#', len), k));
+}
+
+static size_t	ft_cmp(size_t len, size_t k)
+{
+	return (sign(ft_memcmp(src(k), dst(k), len)));
+}
+
+static size_t	lc_cmp(size_t len, size_t k)
+{
+	return (sign(memcmp(src(k), dst(k), len)));
+}
+
+static size_t	ft_mem(size_t len, size_t k)
+{
+	return (at(ft_memmem(src(k), len, "#@#@", 4), k));
+}
+
+static size_t	lc_mem(size_t len, size_t k)
+{
+	return (at(memmem(src(k), len, "#@#@", 4), k));
+}
+
+/* --- strings --- */
+
+static size_t	ft_len(size_t len, size_t k)
+{
+	(void)len;
+	return (ft_strlen(src(k)));
+}
+
+static size_t	lc_len(size_t len, size_t k)
+{
+	(void)len;
+	return (strlen(src(k)));
+}
+
+static size_t	ft_schr(size_t len, size_t k)
+{
+	(void)len;
+	return (at(ft_strchr(src(k), '#'), k));
+}
+
+static size_t	lc_schr(size_t len, size_t k)
+{
+	(void)len;
+	return (at(strchr(src(k), '#'), k));
+}
+
+static size_t	ft_srchr(size_t len, size_t k)
+{
+	(void)len;
+	return (at(ft_strrchr(src(k), '#'), k));
+}
+
+static size_t	lc_srchr(size_t len, size_t k)
+{
+	(void)len;
+	return (at(strrchr(src(k), '#'), k));
+}
+
+static size_t	ft_ncmp(size_t len, size_t k)
+{
+	return (sign(ft_strncmp(src(k), dst(k), len + 1)));
+}
+
+static size_t	lc_ncmp(size_t len, size_t k)
+{
+	return (sign(strncmp(src(k), dst(k), len + 1)));
+}
+
+static size_t	ft_nstr(size_t len, size_t k)
+{
+	return (at(ft_strnstr(src(k), "#@#@", len), k));
+}
+
+static size_t	lc_nstr(size_t len, size_t k)
+{
+	(void)len;
+	return (at(strstr(src(k), "#@#@"), k));
+}
+
+static size_t	ft_lcpy(size_t len, size_t k)
+{
+	return (ft_strlcpy(dst(k), src(k), len + 1));
+}
+
+static size_t	lc_lcpy(size_t len, size_t k)
+{
+	size_t	n;
+
+	(void)len;
+	n = strlen(src(k));
+	memcpy(dst(k), src(k), n + 1);
+	return (n);
+}
+
+static size_t	ft_lcat(size_t len, size_t k)
+{
+	dst(k)[len / 2] = '\0';
+	return (ft_strlcat(dst(k), src(k), 2 * len));
+}
+
+static size_t	lc_lcat(size_t len, size_t k)
+{
+	size_t	a;
+	size_t	n;
+
+	dst(k)[len / 2] = '\0';
+	a = strlen(dst(k));
+	n = strlen(src(k));
+	memcpy(dst(k) + a, src(k), n + 1);
+	return (a + n);
+}
+
+static size_t	ft_dup(size_t len, size_t k)
+{
+	(void)len;
+	return (freed(ft_strdup(src(k))));
+}
+
+static size_t	lc_dup(size_t len, size_t k)
+{
+	(void)len;
+	return (freed(strdup(src(k))));
+}
+
+static size_t	ft_ndup(size_t len, size_t k)
+{
+	return (freed(ft_strndup(src(k), len / 2)));
+}
+
+static size_t	lc_ndup(size_t len, size_t k)
+{
+	return (freed(strndup(src(k), len / 2)));
+}
+
+static size_t	ft_sub(size_t len, size_t k)
+{
+	return (freed(ft_substr(src(k), len / 4, len / 2)));
+}
+
+static size_t	lc_sub(size_t len, size_t k)
+{
+	return (freed(strndup(src(k) + len / 4, len / 2)));
+}
+
+static size_t	ft_join(size_t len, size_t k)
+{
+	(void)len;
+	return (freed(ft_strjoin(src(k), src(k + 1))));
+}
+
+static size_t	lc_join(size_t len, size_t k)
+{
+	size_t	a;
+	size_t	b;
+	char	*s;
+
+	(void)len;
+	a = strlen(src(k));
+	b = strlen(src(k + 1));
+	s = malloc(a + b + 1);
+	memcpy(s, src(k), a);
+	memcpy(s + a, src(k + 1), b + 1);
+	return (freed(s));
+}
+
+static size_t	ft_case(size_t len, size_t k)
+{
+	const char	*s;
+	size_t		r;
+	size_t		i;
+
+	s = src(k);
+	r = 0;
+	i = 0;
+	while (i < len)
+	{
+		r += ft_toupper(s[i]) ^ ft_tolower(s[i] ^ 0x20);
+		i++;
+	}
+	return (r);
+}
+
+static size_t	lc_case(size_t len, size_t k)
+{
+	const char	*s;
+	size_t		r;
+	size_t		i;
+
+	s = src(k);
+	r = 0;
+	i = 0;
+	while (i < len)
+	{
+		r += toupper(s[i]) ^ tolower(s[i] ^ 0x20);
+		i++;
+	}
+	return (r);
+}
+
+static size_t	ft_trim(size_t len, size_t k)
+{
+	(void)len;
+	return (freed(ft_strtrim(src(k), "abcdefgh")));
+}
+
+/* strspn from the front, a strchr loop from the back, then a copy */
+static size_t	lc_trim(size_t len, size_t k)
+{
+	const char	*s;
+	size_t		n;
+
+	(void)len;
+	s = src(k) + strspn(src(k), "abcdefgh");
+	n = strlen(s);
+	while (n > 0 && strchr("abcdefgh", s[n - 1]))
+		n--;
+	return (freed(strndup(s, n)));
+}
+
+static size_t	free_words(char **words, size_t n)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n)
+		free(words[i++]);
+	free(words);
+	return (n);
+}
+
+static size_t	ft_splt(size_t len, size_t k)
+{
+	char	**words;
+	size_t	n;
+
+	(void)len;
+	words = ft_split(src(k), 'a');
+	if (!words)
+		return ((size_t)-1);
+	n = 0;
+	while (words[n])
+		n++;
+	return (free_words(words, n));
+}
+
+/* strtok_r on a copy; every word is duplicated, as ft_split does */
+static size_t	lc_splt(size_t len, size_t k)
+{
+	char	**words;
+	char	*copy;
+	char	*save;
+	char	*w;
+	size_t	n;
+
+	copy = strdup(src(k));
+	words = malloc((len / 2 + 2) * sizeof(char *));
+	if (!copy || !words)
+		return ((size_t)-1);
+	n = 0;
+	w = strtok_r(copy, "a", &save);
+	while (w)
+	{
+		words[n++] = strdup(w);
+		w = strtok_r(NULL, "a", &save);
+	}
+	words[n] = NULL;
+	free(copy);
+	return (free_words(words, n));
+}
+
+/* --- conversions and formatting (k picks the value) --- */
+
+static const char	*g_numstr[8] = {"0", "42", "-7", "  +123456", "2147483647",
+	"-2147483648", "\t\n 99999", "-31337"};
+static const long	g_nums[8] = {0, 42, -7, 123456, 2147483647, -2147483648L,
+	99999, -31337};
+
+static size_t	ft_toi(size_t len, size_t k)
+{
+	(void)len;
+	return (ft_atoi(g_numstr[k & 7]) + ft_atol(g_numstr[(k + 3) & 7]));
+}
+
+static size_t	lc_toi(size_t len, size_t k)
+{
+	(void)len;
+	return (atoi(g_numstr[k & 7]) + atol(g_numstr[(k + 3) & 7]));
+}
+
+static size_t	ft_ito(size_t len, size_t k)
+{
+	(void)len;
+	return (freed(ft_itoa((int)g_nums[k & 7])));
+}
+
+static size_t	lc_ito(size_t len, size_t k)
+{
+	char	*s;
+
+	(void)len;
+	if (asprintf(&s, "%d", (int)g_nums[k & 7]) < 0)
+		return ((size_t)-1);
+	return (freed(s));
+}
+
+static size_t	ft_u64(size_t len, size_t k)
+{
+	char	buf[FT_FMT_BUFSIZE];
+
+	(void)len;
+	return (ft_fmt_u64(buf, (uint64_t)g_nums[k & 7] * 2654435761u));
+}
+
+static size_t	lc_u64(size_t len, size_t k)
+{
+	char	buf[FT_FMT_BUFSIZE];
+
+	(void)len;
+	return (snprintf(buf, sizeof(buf), "%lu",
+			(unsigned long)g_nums[k & 7] * 2654435761u));
+}
+
+static size_t	ft_hex(size_t len, size_t k)
+{
+	char	buf[FT_FMT_BUFSIZE];
+
+	(void)len;
+	return (ft_fmt_hex(buf, (uint64_t)g_nums[k & 7] * 2654435761u, 0));
+}
+
+static size_t	lc_hex(size_t len, size_t k)
+{
+	char	buf[FT_FMT_BUFSIZE];
+
+	(void)len;
+	return (snprintf(buf, sizeof(buf), "%lx",
+			(unsigned long)g_nums[k & 7] * 2654435761u));
+}
+
+static size_t	ft_snp(size_t len, size_t k)
+{
+	char	buf[128];
+
+	(void)len;
+	return (ft_snprintf(buf, sizeof(buf), "pid %d: %s (%x) %u%%",
+			(int)g_nums[k & 7], g_numstr[k & 7], (unsigned)k, (unsigned)len));
+}
+
+static size_t	lc_snp(size_t len, size_t k)
+{
+	char	buf[128];
+
+	(void)len;
+	return (snprintf(buf, sizeof(buf), "pid %d: %s (%x) %u%%",
+			(int)g_nums[k & 7], g_numstr[k & 7], (unsigned)k, (unsigned)len));
+}
+
+static size_t	ft_dpr(size_t len, size_t k)
+{
+	(void)len;
+	return (ft_dprintf(g_devnull, "pid %d: %s (%x)\n",
+			(int)g_nums[k & 7], g_numstr[k & 7], (unsigned)k));
+}
+
+static size_t	lc_dpr(size_t len, size_t k)
+{
+	(void)len;
+	return (dprintf(g_devnull, "pid %d: %s (%x)\n",
+			(int)g_nums[k & 7], g_numstr[k & 7], (unsigned)k));
+}
+
+static size_t	ft_pr(size_t len, size_t k)
+{
+	(void)len;
+	return (ft_printf("pid %d: %s (%x)\n",
+			(int)g_nums[k & 7], g_numstr[k & 7], (unsigned)k));
+}
+
+static size_t	lc_pr(size_t len, size_t k)
+{
+	(void)len;
+	return (printf("pid %d: %s (%x)\n",
+			(int)g_nums[k & 7], g_numstr[k & 7], (unsigned)k));
+}
+
+static size_t	ft_pnbr(size_t len, size_t k)
+{
+	(void)len;
+	ft_putnbr_fd((int)g_nums[k & 7], g_devnull);
+	return (0);
+}
+
+static size_t	lc_pnbr(size_t len, size_t k)
+{
+	(void)len;
+	dprintf(g_devnull, "%d", (int)g_nums[k & 7]);
+	return (0);
+}
+
+/* 16 lines collected in a t_bufwriter and written at once */
+static size_t	ft_bw(size_t len, size_t k)
+{
+	t_bufwriter	bw;
+	size_t		i;
+
+	(void)len;
+	ft_bw_init(&bw, g_devnull, 0);
+	i = 0;
+	while (i < 16)
+	{
+		ft_bw_putstr(&bw, "pid ");
+		ft_bw_putnbr(&bw, g_nums[(k + i) & 7]);
+		ft_bw_putstr(&bw, ": ");
+		ft_bw_putstr(&bw, g_numstr[(k + i) & 7]);
+		ft_bw_putchar(&bw, '\n');
+		i++;
+	}
+	return (ft_bw_flush(&bw) + i);
+}
+
+static size_t	lc_bw(size_t len, size_t k)
+{
+	size_t	i;
+
+	(void)len;
+	i = 0;
+	while (i < 16)
+	{
+		dprintf(g_devnull, "pid %ld: %s\n", g_nums[(k + i) & 7],
+			g_numstr[(k + i) & 7]);
+		i++;
+	}
+	return (i);
+}
+
+static const t_routine	g_routines[] = {
+{"memcpy", "memcpy", ft_cpy, lc_cpy, 1},
+{"memmove/overlap", "memmove", ft_move, lc_move, 1},
+{"memset", "memset", ft_set, lc_set, 1},
+{"bzero", "bzero", ft_zero, lc_zero, 1},
+{"calloc", "calloc", ft_cal, lc_cal, 1},
+{"memchr", "memchr", ft_chr, lc_chr, 1},
+{"memchr/half", "memchr", ft_chr, lc_chr, 2},
+{"memcmp", "memcmp", ft_cmp, lc_cmp, 1},
+{"memcmp/half", "memcmp", ft_cmp, lc_cmp, 2},
+{"memmem", "memmem", ft_mem, lc_mem, 1},
+{"memmem/half", "memmem", ft_mem, lc_mem, 2},
+{"strlen", "strlen", ft_len, lc_len, 1},
+{"strchr", "strchr", ft_schr, lc_schr, 1},
+{"strrchr/half", "strrchr", ft_srchr, lc_srchr, 2},
+{"strncmp", "strncmp", ft_ncmp, lc_ncmp, 1},
+{"strncmp/half", "strncmp", ft_ncmp, lc_ncmp, 2},
+{"strnstr", "strstr", ft_nstr, lc_nstr, 1},
+{"strnstr/half", "strstr", ft_nstr, lc_nstr, 2},
+{"strlcpy", "strlen+memcpy", ft_lcpy, lc_lcpy, 1},
+{"strlcat", "strlen+memcpy", ft_lcat, lc_lcat, 1},
+{"strdup", "strdup", ft_dup, lc_dup, 1},
+{"strndup", "strndup", ft_ndup, lc_ndup, 1},
+{"substr", "strndup", ft_sub, lc_sub, 1},
+{"strjoin", "malloc+memcpy", ft_join, lc_join, 1},
+{"toupper+tolower", "toupper+lower", ft_case, lc_case, 1},
+{"strtrim", "strspn+strndup", ft_trim, lc_trim, 1},
+{"split", "strtok_r", ft_splt, lc_splt, 1},
+{"atoi+atol", "atoi+atol", ft_toi, lc_toi, 0},
+{"itoa", "asprintf", ft_ito, lc_ito, 0},
+{"fmt_u64", "snprintf", ft_u64, lc_u64, 0},
+{"fmt_hex", "snprintf", ft_hex, lc_hex, 0},
+{"snprintf", "snprintf", ft_snp, lc_snp, 0},
+{"dprintf", "dprintf", ft_dpr, lc_dpr, 0},
+{"printf", "printf", ft_pr, lc_pr, 0},
+{"putnbr_fd", "dprintf", ft_pnbr, lc_pnbr, 0},
+{"bw_* x16+flush", "dprintf x16", ft_bw, lc_bw, 0},
+{NULL, NULL, NULL, NULL, 0}
+};
+
+/* --- harness --- */
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/* Core clock in GHz: a chain of dependent adds retires one per cycle */
+static double	cycles_per_ns(void)
+{
+	double	t;
+	long	x;
+	long	i;
+
+	x = 0;
+	i = 0;
+	t = now_ns();
+	while (i < 200000000L)
+	{
+		x += i;
+		__asm__ volatile ("" : "+r"(x));
+		i++;
+	}
+	g_sink = x;
+	return (200000000.0 / (now_ns() - t));
+}
+
+/* Best of three runs, in ns per call */
+static double	time_op(t_op op, size_t len)
+{
+	long	reps;
+	long	i;
+	double	best;
+	double	t;
+	int		run;
+
+	reps = BENCH_BYTES / (long)(len + 64);
+	if (reps < BENCH_MIN_OPS / 40)
+		reps = BENCH_MIN_OPS / 40;
+	if (reps > 50 * BENCH_MIN_OPS)
+		reps = 50 * BENCH_MIN_OPS;
+	best = 0;
+	run = 0;
+	while (run++ < 3)
+	{
+		i = 0;
+		t = now_ns();
+		while (i < reps)
+		{
+			g_sink += op(len, (size_t)i);
+			i++;
+		}
+		t = (now_ns() - t) / reps;
+		if (best == 0 || t < best)
+			best = t;
+	}
+	return (best);
+}
+
+/* ft and libc must agree for every length and misalignment */
+static int	check(void)
+{
+	const t_routine	*r;
+	size_t			l;
+	size_t			k;
+	size_t			got;
+	int				bad;
+
+	bad = 0;
+	r = g_routines;
+	while (r->name)
+	{
+		l = 0;
+		while (g_lens[l] && (r->sized || l == 0))
+		{
+			k = 0;
+			while (k < 4)
+			{
+				prepare(g_lens[l], r->sized == 2);
+				got = r->ft(g_lens[l], k);
+				prepare(g_lens[l], r->sized == 2);
+				if (got != r->ref(g_lens[l], k) && ++bad)
+					dprintf(g_out, "MISMATCH %s len %zu k %zu\n",
+						r->name, g_lens[l], k);
+				k++;
+			}
+			l++;
+		}
+		r++;
+	}
+	dprintf(g_out, "check: %s\n", bad ? "FAILED" : "ok");
+	return (bad != 0);
+}
+
+static void	report(const t_routine *r, size_t len, double ghz)
+{
+	double	ft;
+	double	lc;
+	double	ratio;
+
+	prepare(len, r->sized == 2);
+	lc = time_op(r->ref, len);
+	ft = time_op(r->ft, len);
+	ratio = ft / lc;
+	dprintf(g_out, "%-16s %-14s %6zu %9.1f %9.1f", r->name, r->libc, len,
+		ft, lc);
+	if (r->sized)
+		dprintf(g_out, " %7.2f %8.2f", len / (ft * ghz),
+			len / (lc * ghz));
+	else
+		dprintf(g_out, " %7s %8s", "-", "-");
+	dprintf(g_out, " %8.2f%s\n", ratio,
+		ratio > BENCH_FLAG ? "  <-- >2x slower" : "");
+	if (ratio > BENCH_FLAG && g_nflags < BENCH_MAX_FLAGS)
+		g_flags[g_nflags++] = (t_flag){r->name, len, ratio};
+}
+
+/* Flagged rows again, worst first */
+static void	summary(void)
+{
+	size_t	i;
+	size_t	j;
+	t_flag	tmp;
+
+	dprintf(g_out, "\n%zu row(s) more than %.0fx slower than libc\n",
+		g_nflags, BENCH_FLAG);
+	i = 0;
+	while (++i < g_nflags)
+	{
+		j = i;
+		while (j > 0 && g_flags[j - 1].ratio < g_flags[j].ratio)
+		{
+			tmp = g_flags[j];
+			g_flags[j] = g_flags[j - 1];
+			g_flags[--j] = tmp;
+		}
+	}
+	i = 0;
+	while (i < g_nflags)
+	{
+		dprintf(g_out, "  %-16s len %6zu  %6.2fx\n", g_flags[i].name,
+			g_flags[i].len, g_flags[i].ratio);
+		i++;
+	}
+}
+
+int	main(int argc, char **argv)
+{
+	const t_routine	*r;
+	double			ghz;
+	size_t			l;
+
+	g_devnull = open("/dev/null", O_WRONLY);
+	g_out = dup(STDOUT_FILENO);
+	if (g_devnull < 0 || g_out < 0 || dup2(g_devnull, STDOUT_FILENO) < 0)
+	{
+		perror("/dev/null");
+		return (1);
+	}
+	if (argc > 1 && !strcmp(argv[1], "--check"))
+		return (check());
+	if (check())
+		return (1);
+	ghz = cycles_per_ns();
+	dprintf(g_out, "core clock ~%.2f GHz; ns per call, bytes per cycle, "
+		"best of 3\n\n", ghz);
+	dprintf(g_out, "%-16s %-14s %6s %9s %9s %7s %8s %8s\n", "libft", "libc",
+		"len", "ft ns", "libc ns", "ft B/c", "libc B/c", "ft/libc");
+	r = g_routines;
+	while (r->name)
+	{
+		l = 0;
+		while (r->sized && g_lens[l])
+			report(r, g_lens[l++], ghz);
+		if (!r->sized)
+			report(r, 0, ghz);
+		r++;
+	}
+	summary();
+	return (0);
+}
@@ -0,0 +1,476 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:02:22 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:49:24 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * Equivalence and timing bench for the string scanning kernels.
+ *
+ * Every kernel set (word, SSE2, AVX2 when the CPU has it, and the public
+ * libft entry points) is checked against plain byte loops for every length
+ * up to BENCH_MAX_LEN and every alignment below BENCH_ALIGNS. Inputs are
+ * placed both at the start of a page and flush against an unmapped guard
+ * page, so a kernel that reads across a page boundary crashes the bench.
+ * The timing table then gives ns per call and the speed-up over the byte
+ * loop for a few buffer sizes.
+ *
+ * Usage: make -C libft bench    (or ./bench/bench_scan [--check])
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "libft.h"
+#include "ft_simd.h"
+
+#define BENCH_MAX_LEN	300
+#define BENCH_ALIGNS	64
+#define BENCH_PAGE		4096
+#define BENCH_BYTES		(64L << 20)
+
+typedef struct s_scan_impl
+{
+	const char	*name;
+	int			available;
+	size_t		(*strlen)(const char *s);
+	void		*(*memchr)(const unsigned char *s, unsigned char c, size_t n);
+	char		*(*strchr)(const char *s, char c);
+	char		*(*strrchr)(const char *s, char c);
+	int			(*memcmp)(const unsigned char *a, const unsigned char *b,
+			size_t n);
+	int			(*strncmp)(const unsigned char *a, const unsigned char *b,
+			size_t n);
+}	t_scan_impl;
+
+/* Two readable pages followed by a PROT_NONE guard page */
+typedef struct s_guarded
+{
+	unsigned char	*base;
+	unsigned char	*guard;
+}	t_guarded;
+
+static volatile size_t	g_sink;
+
+/* ------------------------------------------------------------------------ */
+/* Reference byte loops                                                      */
+/* ------------------------------------------------------------------------ */
+
+static size_t	ref_strlen(const char *s)
+{
+	size_t	i;
+
+	i = 0;
+	while (s[i])
+		i++;
+	return (i);
+}
+
+static void	*ref_memchr(const unsigned char *s, unsigned char c, size_t n)
+{
+	while (n-- > 0)
+	{
+		if (*s == c)
+			return ((void *)s);
+		s++;
+	}
+	return (NULL);
+}
+
+static char	*ref_strchr(const char *s, char c)
+{
+	while (*s && *s != c)
+		s++;
+	if (*s == c)
+		return ((char *)s);
+	return (NULL);
+}
+
+static char	*ref_strrchr(const char *s, char c)
+{
+	const char	*last;
+
+	last = NULL;
+	while (*s)
+	{
+		if (*s == c)
+			last = s;
+		s++;
+	}
+	if (c == '\0')
+		return ((char *)s);
+	return ((char *)last);
+}
+
+static int	ref_memcmp(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	while (n-- > 0)
+	{
+		if (*a != *b)
+			return (*a - *b);
+		a++;
+		b++;
+	}
+	return (0);
+}
+
+static int	ref_strncmp(const unsigned char *a, const unsigned char *b,
+		size_t n)
+{
+	while (n-- > 0)
+	{
+		if (*a != *b || *a == '\0')
+			return (*a - *b);
+		a++;
+		b++;
+	}
+	return (0);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Public entry points, wrapped to the kernel signatures                     */
+/* ------------------------------------------------------------------------ */
+
+static void	*pub_memchr(const unsigned char *s, unsigned char c, size_t n)
+{
+	return (ft_memchr(s, c, n));
+}
+
+static char	*pub_strchr(const char *s, char c)
+{
+	return (ft_strchr(s, c));
+}
+
+static char	*pub_strrchr(const char *s, char c)
+{
+	return (ft_strrchr(s, c));
+}
+
+static int	pub_memcmp(const unsigned char *a, const unsigned char *b,
+		size_t n)
+{
+	return (ft_memcmp(a, b, n));
+}
+
+static int	pub_strncmp(const unsigned char *a, const unsigned char *b,
+		size_t n)
+{
+	return (ft_strncmp((const char *)a, (const char *)b, n));
+}
+
+static const t_scan_impl	g_ref = {"bytes", 1, ref_strlen, ref_memchr,
+	ref_strchr, ref_strrchr, ref_memcmp, ref_strncmp};
+
+static int	load_impls(t_scan_impl *impls)
+{
+	int	count;
+
+	count = 0;
+	impls[count++] = (t_scan_impl){"word", 1, ft_strlen_word, ft_memchr_word,
+		ft_strchr_word, ft_strrchr_word, ft_memcmp_word, ft_strncmp_word};
+#if FT_X86_SIMD
+
+	impls[count++] = (t_scan_impl){"sse2", 1, ft_strlen_sse2, ft_memchr_sse2,
+		ft_strchr_sse2, ft_strrchr_sse2, ft_memcmp_sse2, ft_strncmp_sse2};
+	impls[count++] = (t_scan_impl){"avx2", __builtin_cpu_supports("avx2"),
+		ft_strlen_avx2, ft_memchr_avx2, ft_strchr_avx2, ft_strrchr_avx2,
+		ft_memcmp_avx2, ft_strncmp_avx2};
+#endif
+
+	impls[count++] = (t_scan_impl){"libft", 1, ft_strlen, pub_memchr,
+		pub_strchr, pub_strrchr, pub_memcmp, pub_strncmp};
+	return (count);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Equivalence                                                               */
+/* ------------------------------------------------------------------------ */
+
+static int	guarded_init(t_guarded *region)
+{
+	region->base = mmap(NULL, 3 * BENCH_PAGE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (region->base == MAP_FAILED)
+		return (EXIT_FAILURE);
+	region->guard = region->base + 2 * BENCH_PAGE;
+	if (mprotect(region->guard, BENCH_PAGE, PROT_NONE) == -1)
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * Places len bytes of letters plus a terminator either at base + align or
+ * so that the terminator is the last byte before the guard page.
+ */
+static char	*place(t_guarded *region, size_t len, size_t align, int at_end)
+{
+	unsigned char	*s;
+	size_t			i;
+
+	if (at_end)
+		s = region->guard - len - 1 - align;
+	else
+		s = region->base + align;
+	i = 0;
+	while (i < len)
+	{
+		s[i] = 'a' + (rand() & 15);
+		i++;
+	}
+	s[len] = '\0';
+	if (at_end && align)
+		ft_memset(s + len + 1, 'x', align);
+	return ((char *)s);
+}
+
+static int	report(const char *impl, const char *routine, size_t len,
+		size_t arg)
+{
+	fprintf(stderr, "bench: %s %s differs from the byte loop (len=%zu, %zu)\n",
+		impl, routine, len, arg);
+	return (EXIT_FAILURE);
+}
+
+static int	check_search(const t_scan_impl *impl, const char *s, size_t len,
+		size_t align)
+{
+	static const char	needles[] = {'a', 'h', 'p', 'x', 'z', '\0'};
+	size_t				k;
+	const unsigned char	*u;
+
+	u = (const unsigned char *)s;
+	if (impl->strlen(s) != len)
+		return (report(impl->name, "strlen", len, align));
+	k = 0;
+	while (k < sizeof(needles))
+	{
+		if (impl->strchr(s, needles[k]) != ref_strchr(s, needles[k]))
+			return (report(impl->name, "strchr", len, align));
+		if (impl->strrchr(s, needles[k]) != ref_strrchr(s, needles[k]))
+			return (report(impl->name, "strrchr", len, align));
+		if (impl->memchr(u, needles[k], len) != ref_memchr(u, needles[k], len)
+			|| impl->memchr(u, needles[k], len + 1)
+			!= ref_memchr(u, needles[k], len + 1))
+			return (report(impl->name, "memchr", len, align));
+		k++;
+	}
+	return (EXIT_SUCCESS);
+}
+
+static int	sign(int v)
+{
+	return ((v > 0) - (v < 0));
+}
+
+/*
+ * Compares s with a copy of itself that differs at one random position
+ * (or nowhere), over several bounds including the terminator.
+ */
+static int	check_compare(const t_scan_impl *impl, const char *s, char *t,
+		size_t len)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+	size_t				bounds[4];
+	size_t				k;
+
+	a = (const unsigned char *)s;
+	b = (const unsigned char *)t;
+	bounds[0] = len;
+	bounds[1] = len + 1;
+	bounds[2] = len / 2;
+	bounds[3] = (size_t)-1;
+	k = 0;
+	while (k < 4)
+	{
+		if (k < 2 && sign(impl->memcmp(a, b, bounds[k]))
+			!= sign(ref_memcmp(a, b, bounds[k])))
+			return (report(impl->name, "memcmp", len, bounds[k]));
+		if (sign(impl->strncmp(a, b, bounds[k]))
+			!= sign(ref_strncmp(a, b, bounds[k])))
+			return (report(impl->name, "strncmp", len, bounds[k]));
+		k++;
+	}
+	return (EXIT_SUCCESS);
+}
+
+static int	check_one(const t_scan_impl *impl, t_guarded *regions, size_t len,
+		size_t align)
+{
+	char	*s;
+	char	*t;
+	int		at_end;
+
+	at_end = 0;
+	while (at_end < 2)
+	{
+		s = place(&regions[0], len, align, at_end);
+		if (check_search(impl, s, len, align) == EXIT_FAILURE)
+			return (EXIT_FAILURE);
+		t = place(&regions[1], len, (align * 7) % BENCH_ALIGNS, !at_end);
+		ft_memcpy(t, s, len + 1);
+		if (len > 0 && (rand() & 3))
+			t[rand() % len] ^= (rand() & 1) * 0x20 + 1;
+		if (len > 0 && (rand() & 7) == 0)
+			t[rand() % len] = '\0';
+		if (check_compare(impl, s, t, len) == EXIT_FAILURE)
+			return (EXIT_FAILURE);
+		at_end++;
+	}
+	return (EXIT_SUCCESS);
+}
+
+static int	check_impl(const t_scan_impl *impl, t_guarded *regions)
+{
+	size_t	len;
+	size_t	align;
+
+	len = 0;
+	while (len <= BENCH_MAX_LEN)
+	{
+		align = 0;
+		while (align < BENCH_ALIGNS)
+		{
+			if (check_one(impl, regions, len, align) == EXIT_FAILURE)
+				return (EXIT_FAILURE);
+			align++;
+		}
+		len++;
+	}
+	printf("%-6s matches the byte loops on lengths 0..%d, %d alignments\n",
+		impl->name, BENCH_MAX_LEN, BENCH_ALIGNS);
+	return (EXIT_SUCCESS);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Timing                                                                    */
+/* ------------------------------------------------------------------------ */
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/* Runs routine `which` of impl over buf; the tail of buf holds the needle */
+static double	time_routine(const t_scan_impl *impl, int which,
+		const char *buf, size_t size)
+{
+	const unsigned char	*u;
+	long				reps;
+	long				i;
+	double				start;
+
+	u = (const unsigned char *)buf;
+	reps = BENCH_BYTES / (long)(size + 16);
+	i = 0;
+	start = now_ns();
+	while (i++ < reps)
+	{
+		if (which == 0)
+			g_sink += impl->strlen(buf);
+		else if (which == 1)
+			g_sink += (size_t)impl->memchr(u, '!', size);
+		else if (which == 2)
+			g_sink += (size_t)impl->strchr(buf, '!');
+		else if (which == 3)
+			g_sink += (size_t)impl->strrchr(buf, 'a');
+		else if (which == 4)
+			g_sink += impl->memcmp(u, u + size + 1, size);
+		else
+			g_sink += impl->strncmp(u, u + size + 1, size);
+	}
+	return ((now_ns() - start) / reps);
+}
+
+static void	time_size(const t_scan_impl *impls, int count, char *buf,
+		size_t size)
+{
+	static const char	*names[] = {"strlen", "memchr", "strchr",
+		"strrchr", "memcmp", "strncmp"};
+	double				base;
+	double				ns;
+	int					which;
+	int					k;
+
+	ft_memset(buf, 'b', size);
+	buf[0] = 'a';
+	buf[size] = '\0';
+	ft_memcpy(buf + size + 1, buf, size + 1);
+	which = -1;
+	while (++which < 6)
+	{
+		base = time_routine(&g_ref, which, buf, size);
+		printf("%-8s %7zu %9.1f", names[which], size, base);
+		k = -1;
+		while (++k < count)
+		{
+			if (!impls[k].available)
+				continue ;
+			ns = time_routine(&impls[k], which, buf, size);
+			printf(" %9.1f (%5.1fx)", ns, base / ns);
+		}
+		printf("\n");
+	}
+}
+
+static void	time_impls(const t_scan_impl *impls, int count)
+{
+	static const size_t	sizes[] = {16, 64, 256, 4096, 65536};
+	char				*buf;
+	size_t				i;
+	int					k;
+
+	buf = malloc(2 * 65536 + 64);
+	if (!buf)
+		return ;
+	printf("\n%-8s %7s %9s", "routine", "size", "bytes ns");
+	k = -1;
+	while (++k < count)
+		if (impls[k].available)
+			printf(" %9s ns (speedup)", impls[k].name);
+	printf("\n");
+	i = 0;
+	while (i < sizeof(sizes) / sizeof(sizes[0]))
+		time_size(impls, count, buf, sizes[i++]);
+	free(buf);
+}
+
+int	main(int argc, char **argv)
+{
+	t_scan_impl	impls[4];
+	t_guarded	regions[2];
+	int			count;
+	int			k;
+
+	if (guarded_init(&regions[0]) == EXIT_FAILURE
+		|| guarded_init(&regions[1]) == EXIT_FAILURE)
+	{
+		fprintf(stderr, "bench: cannot map test pages\n");
+		return (EXIT_FAILURE);
+	}
+	srand(42);
+	count = load_impls(impls);
+	k = -1;
+	while (++k < count)
+	{
+		if (!impls[k].available)
+			printf("%-6s skipped, not supported by this CPU\n", impls[k].name);
+		else if (check_impl(&impls[k], regions) == EXIT_FAILURE)
+			return (EXIT_FAILURE);
+	}
+	printf("libft dispatches to the %s kernels\n",
+		ft_cpu_level_name(ft_cpu_level()));
+	if (argc < 2 || ft_strncmp(argv[1], "--check", 8) != 0)
+		time_impls(impls, count);
+	return (EXIT_SUCCESS);
+}
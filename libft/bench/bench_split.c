@@ -0,0 +1,203 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_split.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:16:14 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:16:14 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * Equivalence and timing bench for the three ways of splitting a string.
+ *
+ * ft_split allocates every word separately, ft_split_flat returns one block
+ * holding the pointer array and the words, and the t_tokenizer iterator
+ * yields views without allocating. All three are first checked against each
+ * other on random inputs (runs of delimiters at either end included), then
+ * timed on a text of BENCH_TOKENS words with one or more delimiters between
+ * them.
+ *
+ * Usage: make -C libft bench    (or ./bench/bench_split [--check])
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libft.h"
+
+#define BENCH_DELIMS	" ,\t"
+#define BENCH_ROUNDS	20000
+#define BENCH_TOKENS	1000000
+#define BENCH_REPS		5
+
+static volatile size_t	g_sink;
+
+/* Words of 1 to 12 letters separated by runs of 1 to 3 delimiters */
+static size_t	make_text(char *buf, size_t words, int edges)
+{
+	size_t	len;
+	int		k;
+
+	len = 0;
+	if (edges)
+		buf[len++] = BENCH_DELIMS[rand() % 3];
+	while (words-- > 0)
+	{
+		k = 1 + rand() % 12;
+		while (k-- > 0)
+			buf[len++] = 'a' + rand() % 26;
+		k = 1 + (rand() % 4 == 0) * (rand() % 3);
+		while (k-- > 0 && (words > 0 || edges))
+			buf[len++] = BENCH_DELIMS[rand() % 3];
+	}
+	buf[len] = '\0';
+	return (len);
+}
+
+static int	same_word(const char *word, const char *view, size_t view_len)
+{
+	return (ft_strlen(word) == view_len
+		&& ft_memcmp(word, view, view_len) == 0);
+}
+
+/* Compares the three splitters on one input; returns 1 on a mismatch */
+static int	check_one(const char *text)
+{
+	t_tokenizer	tok;
+	const char	*view;
+	size_t		view_len;
+	char		**split;
+	char		**flat;
+	size_t		i;
+	int			bad;
+
+	split = ft_split_set(text, BENCH_DELIMS);
+	flat = ft_split_flat(text, BENCH_DELIMS);
+	if (!split || !flat)
+		return (1);
+	ft_tok_init(&tok, text, ft_strlen(text), BENCH_DELIMS);
+	bad = 0;
+	i = 0;
+	while (!bad && ft_tok_next(&tok, &view, &view_len))
+	{
+		bad = !split[i] || !flat[i] || ft_strncmp(split[i], flat[i],
+				(size_t)-1) != 0 || !same_word(split[i], view, view_len);
+		i++;
+	}
+	bad = bad || split[i] || flat[i];
+	ft_free_array(split);
+	free(flat);
+	return (bad);
+}
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+static size_t	run_split(const char *text, size_t len)
+{
+	char	**words;
+	size_t	count;
+
+	(void)len;
+	words = ft_split_set(text, BENCH_DELIMS);
+	count = 0;
+	while (words && words[count])
+		count++;
+	ft_free_array(words);
+	return (count);
+}
+
+static size_t	run_flat(const char *text, size_t len)
+{
+	char	**words;
+	size_t	count;
+
+	(void)len;
+	words = ft_split_flat(text, BENCH_DELIMS);
+	count = 0;
+	while (words && words[count])
+		count++;
+	free(words);
+	return (count);
+}
+
+static size_t	run_tokenizer(const char *text, size_t len)
+{
+	t_tokenizer	tok;
+	const char	*view;
+	size_t		view_len;
+	size_t		count;
+
+	ft_tok_init(&tok, text, len, BENCH_DELIMS);
+	count = 0;
+	while (ft_tok_next(&tok, &view, &view_len))
+		count++;
+	return (count);
+}
+
+/* Best of BENCH_REPS runs, including the time to free the result */
+static void	time_split(const char *name, const char *allocs,
+		size_t (*run)(const char *, size_t), const char *text)
+{
+	double	best;
+	double	start;
+	double	elapsed;
+	size_t	len;
+	int		rep;
+
+	len = ft_strlen(text);
+	best = -1;
+	rep = 0;
+	while (rep++ < BENCH_REPS)
+	{
+		start = now_ns();
+		g_sink += run(text, len);
+		elapsed = now_ns() - start;
+		if (best < 0 || elapsed < best)
+			best = elapsed;
+	}
+	printf("%-14s %10.2f %10.2f   %s\n", name, best / 1e6,
+		best / BENCH_TOKENS, allocs);
+}
+
+int	main(int argc, char **argv)
+{
+	char	*text;
+	int		round;
+
+	text = malloc(BENCH_TOKENS * 16L + 2);
+	if (!text)
+		return (EXIT_FAILURE);
+	srand(42);
+	round = 0;
+	while (round < BENCH_ROUNDS)
+	{
+		make_text(text, round % 16, round & 1);
+		if (check_one(text))
+		{
+			fprintf(stderr, "bench: splitters differ on \"%s\"\n", text);
+			free(text);
+			return (EXIT_FAILURE);
+		}
+		round++;
+	}
+	printf("ft_split, ft_split_flat and ft_tok_next agree\n");
+	if (!(argc > 1 && ft_strncmp(argv[1], "--check", 8) == 0))
+	{
+		printf("\n%-14s %10s %10s   (%d tokens, %zu bytes)\n", "splitter",
+			"ms", "ns/token", BENCH_TOKENS,
+			make_text(text, BENCH_TOKENS, 0));
+		time_split("ft_split", "n + 1 mallocs", run_split, text);
+		time_split("ft_split_flat", "1 malloc", run_flat, text);
+		time_split("ft_tok_next", "no malloc", run_tokenizer, text);
+	}
+	free(text);
+	return (EXIT_SUCCESS);
+}
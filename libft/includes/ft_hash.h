@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hash.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:34:31 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:34:31 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_HASH_H
+# define FT_HASH_H
+
+/*
+ * Internal header for the t_hmap Robin Hood tables. Not part of the public
+ * libft API.
+ */
+
+# include <sys/types.h>
+# include "libft.h"
+
+/* Slots of the first table; tables double from here */
+# define HMAP_MIN_SLOTS		16
+
+/* Old slots migrated by each put/del while a resize is in progress */
+# define HMAP_DRAIN_STEPS	256
+
+/* A key ready for lookup: its hash plus the integer or the bytes */
+typedef struct s_hkey
+{
+	uint64_t	hash;
+	uint64_t	ikey;
+	const void	*bytes;
+	size_t		len;
+}	t_hkey;
+
+ssize_t	ft_htable_find(const t_htable *t, const t_hkey *key, int bytes);
+void	ft_htable_place(t_htable *t, t_hslot slot);
+void	ft_htable_remove(t_htable *t, size_t i);
+int		ft_htable_alloc(t_htable *t, size_t size);
+void	ft_htable_release(t_htable *t);
+int		ft_hmap_reserve(t_hmap *map);
+void	ft_hmap_drain(t_hmap *map, size_t steps);
+void	**ft_hmap_find(t_hmap *map, const t_hkey *key);
+int		ft_hmap_insert(t_hmap *map, const t_hkey *key, void *value);
+int		ft_hmap_remove(t_hmap *map, const t_hkey *key, void **value);
+
+/* splitmix64 finalizer: a bijection, so equal hashes mean equal int keys */
+static inline uint64_t	ft_hash_mix(uint64_t z)
+{
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return (z ^ (z >> 31));
+}
+
+#endif
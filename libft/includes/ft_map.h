@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_map.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:25:35 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:25:35 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_MAP_H
+# define FT_MAP_H
+
+/*
+ * Internal header for page-mapped storage: anonymous mappings that grow by
+ * remapping pages instead of copying bytes. Not part of the public libft API.
+ */
+
+# include <stddef.h>
+
+/* Blocks larger than this are worth a mapping of their own */
+# define FT_MAP_THRESHOLD	(1UL << 20)
+
+void	*ft_map_alloc(size_t size);
+void	*ft_map_resize(void *p, size_t old_size, size_t new_size);
+void	ft_map_discard(void *p, size_t size);
+void	ft_map_free(void *p, size_t size);
+size_t	ft_map_round(size_t size);
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/14 23:51:20 by fyudris           #+#    #+#             */
-/*   Updated: 2025/02/24 15:37:56 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:29:38 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,18 +17,49 @@
 # include <stdlib.h>
 # include <limits.h>
 # include <unistd.h>
+# include "libft.h"
 
-# define HEX_LOWER	"0123456789abcdef"
-# define HEX_UPPER	"0123456789ABCDEF"
+// Letter case for ft_print_hex (see ft_fmt_hex)
+# define HEX_LOWER	0
+# define HEX_UPPER	1
+
+// Output is formatted into a stack buffer of this size and flushed with a
+// single write() per call (or per full buffer for longer output).
+# define PF_BUFFER_SIZE	1024
+
+/*
+ * Formatting state shared by the whole printf family.
+ * fd >= 0: output goes to `data` and is flushed to `fd`.
+ * fd < 0:  output goes straight to `dst` (ft_snprintf), truncated to
+ *          `dst_size - 1` characters.
+ */
+typedef struct s_pfbuf
+{
+	char	data[PF_BUFFER_SIZE];
+	size_t	len;
+	int		fd;
+	char	*dst;
+	size_t	dst_size;
+	size_t	total;
+	int		error;
+}	t_pfbuf;
 
 int		ft_printf(const char *format, ...);
-int		ft_handle_format(char specifier, va_list args);
-int		ft_print_char(char c);
-int		ft_print_str(const char *str);
-int		ft_print_int(int n);
-int		ft_print_unsigned_int(unsigned int n);
-int		ft_print_pointer(void *ptr);
-int		ft_print_hex(unsigned long long n, const char *base);
+int		ft_dprintf(int fd, const char *format, ...);
+int		ft_vdprintf(int fd, const char *format, va_list args);
+int		ft_snprintf(char *str, size_t size, const char *format, ...);
+int		ft_vsnprintf(char *str, size_t size, const char *format,
+			va_list args);
+int		ft_pf_format(t_pfbuf *buf, const char *format, va_list *args);
+int		ft_handle_format(t_pfbuf *buf, char specifier, va_list *args);
+void	ft_pf_putbytes(t_pfbuf *buf, const char *s, size_t n);
+int		ft_pf_flush(t_pfbuf *buf);
+int		ft_print_char(t_pfbuf *buf, char c);
+int		ft_print_str(t_pfbuf *buf, const char *str);
+int		ft_print_int(t_pfbuf *buf, int n);
+int		ft_print_unsigned_int(t_pfbuf *buf, unsigned int n);
+int		ft_print_pointer(t_pfbuf *buf, void *ptr);
+int		ft_print_hex(t_pfbuf *buf, unsigned long long n, int upper);
 size_t	ft_strlen(const char *str);
 
 #endif
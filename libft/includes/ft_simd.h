@@ -0,0 +1,184 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_simd.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:39:16 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:46:46 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_SIMD_H
+# define FT_SIMD_H
+
+/*
+ * Internal header for the word-at-a-time and vector kernels behind the
+ * libft memory and string functions. Not part of the public libft API.
+ */
+
+# include <stddef.h>
+# include <stdint.h>
+# include "libft.h"
+
+/* Machine word that may be loaded from any address and may alias anything */
+typedef uint64_t __attribute__((__may_alias__, __aligned__(1)))	t_uword;
+
+# define WORD_SIZE		8
+# define WORD_ONES		0x0101010101010101ULL
+# define WORD_LOW7S		0x7F7F7F7F7F7F7F7FULL
+# define WORD_HIGHS		0x8080808080808080ULL
+
+/* Unaligned loads closer than this to a page end may fault past the data */
+# define FT_PAGE_SIZE	4096
+
+/* Below this size the word kernels beat the setup cost of the vector ones */
+# define VEC_MIN_SIZE	32
+
+# if defined(__x86_64__)
+#  define FT_X86_SIMD	1
+#  include <immintrin.h>
+#  define FT_SSE42		__attribute__((__target__("sse4.2")))
+#  define FT_AVX2		__attribute__((__target__("avx2")))
+# else
+#  define FT_X86_SIMD	0
+# endif
+
+/*
+ * Sets the high bit of every zero byte of w and nothing else. Unlike the
+ * shorter (w - ones) & ~w form there are no false positives above the first
+ * zero, so the flags can be located from either end.
+ */
+static inline uint64_t	ft_word_zeros(uint64_t w)
+{
+	return (~(((w & WORD_LOW7S) + WORD_LOW7S) | w | WORD_LOW7S));
+}
+
+/* Offset of the lowest-addressed byte flagged in mask (mask != 0) */
+static inline size_t	ft_word_first(uint64_t mask)
+{
+# if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+
+	return (__builtin_clzll(mask) >> 3);
+# else
+
+	return (__builtin_ctzll(mask) >> 3);
+# endif
+}
+
+/* Offset of the highest-addressed byte flagged in mask (mask != 0) */
+static inline size_t	ft_word_last(uint64_t mask)
+{
+# if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+
+	return (__builtin_ctzll(mask) >> 3);
+# else
+
+	return ((63 - __builtin_clzll(mask)) >> 3);
+# endif
+}
+
+/* True when width bytes can be read from p without crossing a page */
+static inline int	ft_page_safe(const void *p, size_t width)
+{
+	return (((uintptr_t)p & (FT_PAGE_SIZE - 1)) <= FT_PAGE_SIZE - width);
+}
+
+/*
+ * Kernel table filled once per process from the CPU level (see
+ * ft_dispatch.c). Public functions route through ft_dispatch(), which
+ * fills the table on first use if the startup constructor has not run yet.
+ * `state` goes UNSET -> FILLING -> READY once; the kernels are only read
+ * once it is READY.
+ */
+# define FT_DISPATCH_UNSET		0
+# define FT_DISPATCH_FILLING	1
+# define FT_DISPATCH_READY		2
+
+typedef struct s_ft_dispatch
+{
+	int			state;
+	int			level;
+	void		(*memcpy)(unsigned char *d, const unsigned char *s, size_t n);
+	void		(*memmove)(unsigned char *d, const unsigned char *s, size_t n);
+	void		(*memset)(unsigned char *d, unsigned char c, size_t n);
+	size_t		(*strlen)(const char *s);
+	void		*(*memchr)(const unsigned char *s, unsigned char c, size_t n);
+	char		*(*strchr)(const char *s, char c);
+	char		*(*strrchr)(const char *s, char c);
+	int			(*memcmp)(const unsigned char *a, const unsigned char *b,
+			size_t n);
+	int			(*strncmp)(const unsigned char *a, const unsigned char *b,
+			size_t n);
+	uint32_t	(*crc32)(uint32_t crc, const unsigned char *s, size_t n);
+	int			(*utf8_valid)(const unsigned char *s, size_t n);
+	size_t		(*byteset_span)(const t_byteset *set, const unsigned char *s,
+			size_t n, int in_set);
+}	t_ft_dispatch;
+
+extern t_ft_dispatch	g_ft_dispatch;
+
+void	ft_dispatch_init(void);
+
+static inline const t_ft_dispatch	*ft_dispatch(void)
+{
+	if (__builtin_expect(__atomic_load_n(&g_ft_dispatch.state,
+				__ATOMIC_ACQUIRE) != FT_DISPATCH_READY, 0))
+		ft_dispatch_init();
+	return (&g_ft_dispatch);
+}
+
+void	ft_memcpy_word(unsigned char *d, const unsigned char *s, size_t n);
+void	ft_memmove_word(unsigned char *d, const unsigned char *s, size_t n);
+void	ft_memset_word(unsigned char *d, unsigned char c, size_t n);
+size_t	ft_strlen_word(const char *s);
+void	*ft_memchr_word(const unsigned char *s, unsigned char c, size_t n);
+char	*ft_strchr_word(const char *s, char c);
+char	*ft_strrchr_word(const char *s, char c);
+int		ft_memcmp_word(const unsigned char *a, const unsigned char *b,
+			size_t n);
+int		ft_strncmp_word(const unsigned char *a, const unsigned char *b,
+			size_t n);
+int		ft_strncmp_bytes(const unsigned char *a, const unsigned char *b,
+			size_t n, int *stop);
+uint32_t	ft_crc32_table(uint32_t crc, const unsigned char *s, size_t n);
+size_t	ft_utf8_seq(const unsigned char *s, size_t n);
+int		ft_utf8_valid_word(const unsigned char *s, size_t n);
+size_t	ft_byteset_span_word(const t_byteset *set, const unsigned char *s,
+			size_t n, int in_set);
+
+# if FT_X86_SIMD
+
+void	ft_memcpy_sse2(unsigned char *d, const unsigned char *s, size_t n);
+void	ft_memmove_sse2(unsigned char *d, const unsigned char *s, size_t n);
+void	ft_memset_sse2(unsigned char *d, unsigned char c, size_t n);
+void	ft_memcpy_avx2(unsigned char *d, const unsigned char *s, size_t n);
+void	ft_memmove_avx2(unsigned char *d, const unsigned char *s, size_t n);
+void	ft_memset_avx2(unsigned char *d, unsigned char c, size_t n);
+size_t	ft_strlen_sse2(const char *s);
+void	*ft_memchr_sse2(const unsigned char *s, unsigned char c, size_t n);
+char	*ft_strchr_sse2(const char *s, char c);
+char	*ft_strrchr_sse2(const char *s, char c);
+int		ft_memcmp_sse2(const unsigned char *a, const unsigned char *b,
+			size_t n);
+int		ft_strncmp_sse2(const unsigned char *a, const unsigned char *b,
+			size_t n);
+size_t	ft_strlen_avx2(const char *s);
+void	*ft_memchr_avx2(const unsigned char *s, unsigned char c, size_t n);
+char	*ft_strchr_avx2(const char *s, char c);
+char	*ft_strrchr_avx2(const char *s, char c);
+int		ft_memcmp_avx2(const unsigned char *a, const unsigned char *b,
+			size_t n);
+int		ft_strncmp_avx2(const unsigned char *a, const unsigned char *b,
+			size_t n);
+uint32_t	ft_crc32_sse42(uint32_t crc, const unsigned char *s, size_t n);
+int		ft_utf8_valid_sse2(const unsigned char *s, size_t n);
+int		ft_utf8_valid_avx2(const unsigned char *s, size_t n);
+size_t	ft_byteset_span_sse42(const t_byteset *set, const unsigned char *s,
+			size_t n, int in_set);
+size_t	ft_byteset_span_avx2(const t_byteset *set, const unsigned char *s,
+			size_t n, int in_set);
+
+# endif
+#endif
@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/08 17:46:56 by fyudris           #+#    #+#             */
-/*   Updated: 2025/06/04 15:09:07 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 14:47:28 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,6 +16,109 @@
 # include <unistd.h>
 # include <stdlib.h>
 # include <limits.h>
+# include <stdint.h>
+
+// Buffer size of a t_bufwriter (see ft_bufwriter.c)
+# define FT_BW_CAPACITY	4096
+
+// Room needed by ft_fmt_u64/i64/hex (see ft_fmt.c)
+# define FT_FMT_BUFSIZE	24
+
+// Nodes carved from each malloc of a t_lstpool (see ft_lstpool.c)
+# define FT_LSTPOOL_BLOCK	256
+
+// Default chunk size and alignment of a t_arena (see ft_arena.c)
+# define FT_ARENA_CHUNK	65536
+# define FT_ARENA_ALIGN	16
+
+// Smallest allocation of a t_strbuf (see ft_strbuf.c)
+# define FT_SB_MIN_CAPACITY	64
+
+// Instruction set levels for kernel dispatch, lowest first (see ft_cpu.c)
+typedef enum e_cpu_level
+{
+	FT_CPU_WORD,
+	FT_CPU_SSE2,
+	FT_CPU_SSE42,
+	FT_CPU_AVX2
+}	t_cpu_level;
+
+/*
+ * Set of byte values: one bit per value for scalar tests, plus the same
+ * bits regrouped by low nibble for SIMD classification with pshufb (see
+ * ft_byteset.c).
+ */
+typedef struct s_byteset
+{
+	uint64_t		bits[4];
+	unsigned char	nibble_lo[16];
+	unsigned char	nibble_hi[16];
+}	t_byteset;
+
+// Zero-copy iterator over the tokens of a buffer (see ft_tokenizer.c)
+typedef struct s_tokenizer
+{
+	const char	*pos;
+	size_t		left;
+	t_byteset	delims;
+}	t_tokenizer;
+
+typedef struct s_arena_chunk
+{
+	struct s_arena_chunk	*next;
+	size_t					size;
+	size_t					used;
+}	t_arena_chunk;
+
+// Bump allocator over a chain of chunks (see ft_arena.c)
+typedef struct s_arena
+{
+	t_arena_chunk	*first;
+	t_arena_chunk	*cur;
+	size_t			chunk_size;
+}	t_arena;
+
+// Fill level of a t_arena to rewind to (see ft_arena_scope.c)
+typedef struct s_arena_mark
+{
+	t_arena_chunk	*chunk;
+	size_t			used;
+}	t_arena_mark;
+
+// Slot of a t_hmap table; dist is the probe distance + 1, 0 when empty
+typedef struct s_hslot
+{
+	uint64_t	hash;
+	uint64_t	key;
+	void		*value;
+	uint32_t	key_len;
+	uint32_t	dist;
+}	t_hslot;
+
+typedef struct s_htable
+{
+	t_hslot	*slots;
+	size_t	mask;
+	size_t	count;
+}	t_htable;
+
+// Robin Hood hash map with integer or byte keys (see ft_hmap.c)
+typedef struct s_hmap
+{
+	t_htable	cur;
+	t_htable	old;
+	size_t		drain;
+	int			bytes;
+}	t_hmap;
+
+// Growable byte string; data[0..len) is in use (see ft_strbuf.c)
+typedef struct s_strbuf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+	int		mapped;
+}	t_strbuf;
 
 typedef struct s_list
 {
@@ -23,6 +126,38 @@ typedef struct s_list
 	struct s_list	*next;
 }	t_list;
 
+typedef struct s_lstblock
+{
+	struct s_lstblock	*next;
+	t_list				nodes[FT_LSTPOOL_BLOCK];
+}	t_lstblock;
+
+// Node allocator for t_list (see ft_lstpool.c)
+typedef struct s_lstpool
+{
+	t_lstblock	*blocks;
+	t_list		*free;
+	size_t		carved;
+}	t_lstpool;
+
+// t_list with O(1) append, size and splice (see ft_lstq.c)
+typedef struct s_lstq
+{
+	t_list		*head;
+	t_list		*tail;
+	size_t		count;
+	t_lstpool	*pool;
+}	t_lstq;
+
+typedef struct s_bufwriter
+{
+	int		fd;
+	int		error;
+	size_t	len;
+	size_t	threshold;
+	char	data[FT_BW_CAPACITY];
+}	t_bufwriter;
+
 int			ft_isalpha(int c);
 int			ft_isdigit(int c);
 int			ft_isalnum(int c);
@@ -44,20 +179,51 @@ void		*ft_memcpy(void *dest, const void *src, size_t n);
 void		*ft_memmove(void *dest, const void *src, size_t n);
 void		*ft_memchr(const void *s, int c, size_t n);
 int			ft_memcmp(const void *s1, const void *s2, size_t n);
+void		*ft_memmem(const void *big, size_t big_len, const void *little,
+				size_t little_len);
 char		*ft_substr(char const *s, unsigned int start, size_t len);
 void		*ft_calloc(size_t nmemb, size_t size);
 void		*ft_realloc(void *ptr, size_t old_size, size_t new_size);
 char		*ft_strdup(const char *s);
+char		*ft_strndup(const char *s, size_t n);
 char		*ft_strjoin(char const *s1, char const *s2);
 char		*ft_strtrim(char const *s1, char const *set);
 char		**ft_split(const char *s, char c);
+char		**ft_split_set(const char *s, const char *set);
+char		**ft_split_flat(const char *s, const char *set);
+void		ft_tok_init(t_tokenizer *tok, const char *s, size_t len,
+				const char *delims);
+int			ft_tok_next(t_tokenizer *tok, const char **token,
+				size_t *token_len);
+size_t		ft_tok_count(const t_tokenizer *tok);
 char		*ft_itoa(int n);
+size_t		ft_fmt_u64(char *buf, uint64_t n);
+size_t		ft_fmt_i64(char *buf, int64_t n);
+size_t		ft_fmt_hex(char *buf, uint64_t n, int upper);
 char		*ft_strmapi(char const *s, char (*f)(unsigned int, char));
 void		ft_striteri(char *s, void (*f)(unsigned int, char*));
 int			ft_putchar_fd(char c, int fd);
 int			ft_putstr_fd(char *s, int fd);
 void		ft_putendl_fd(char *s, int fd);
 void		ft_putnbr_fd(int n, int fd);
+ssize_t		ft_write_all(int fd, const void *buf, size_t n);
+void		ft_bw_init(t_bufwriter *bw, int fd, size_t threshold);
+int			ft_bw_flush(t_bufwriter *bw);
+int			ft_bw_putbytes(t_bufwriter *bw, const void *s, size_t n);
+int			ft_bw_putstr(t_bufwriter *bw, const char *s);
+int			ft_bw_putchar(t_bufwriter *bw, char c);
+int			ft_bw_putnbr(t_bufwriter *bw, long n);
+int			ft_bw_putunbr(t_bufwriter *bw, unsigned long n);
+void		ft_sb_init(t_strbuf *sb);
+int			ft_sb_reserve(t_strbuf *sb, size_t extra);
+int			ft_sb_shrink(t_strbuf *sb);
+void		ft_sb_clear(t_strbuf *sb);
+void		ft_sb_free(t_strbuf *sb);
+int			ft_sb_append_bytes(t_strbuf *sb, const void *s, size_t n);
+int			ft_sb_append_char(t_strbuf *sb, char c);
+int			ft_sb_append_str(t_strbuf *sb, const char *s);
+int			ft_sb_append_u64(t_strbuf *sb, uint64_t n);
+char		*ft_sb_cstr(t_strbuf *sb);
 t_list		*ft_lstnew(void *content);
 void		ft_lstadd_front(t_list **lst, t_list *new);
 int			ft_lstsize(t_list *lst);
@@ -67,6 +233,54 @@ void		ft_lstdelone(t_list *lst, void (*del)(void*));
 void		ft_lstclear(t_list **lst, void (*del)(void *));
 void		ft_lstiter(t_list *lst, void (*f)(void *));
 t_list		*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *));
+void		ft_lstpool_init(t_lstpool *pool);
+t_list		*ft_lstpool_new(t_lstpool *pool, void *content);
+void		ft_lstpool_release(t_lstpool *pool, t_list *node);
+void		ft_lstpool_destroy(t_lstpool *pool);
+void		ft_lstq_init(t_lstq *q, t_lstpool *pool);
+void		ft_lstq_append(t_lstq *q, t_list *node);
+int			ft_lstq_push(t_lstq *q, void *content);
+void		*ft_lstq_pop(t_lstq *q);
+void		ft_lstq_splice(t_lstq *dst, t_lstq *src);
+size_t		ft_lstq_size(const t_lstq *q);
+void		ft_lstq_clear(t_lstq *q, void (*del)(void *));
+void		ft_arena_init(t_arena *arena, size_t chunk_size);
+void		*ft_arena_alloc(t_arena *arena, size_t size);
+void		*ft_arena_alloc_aligned(t_arena *arena, size_t size, size_t align);
+t_arena_mark	ft_arena_mark(const t_arena *arena);
+void		ft_arena_rewind(t_arena *arena, t_arena_mark mark);
+void		ft_arena_reset(t_arena *arena);
+void		ft_arena_release(t_arena *arena);
+char		*ft_arena_strndup(t_arena *arena, const char *s, size_t n);
+char		*ft_arena_strdup(t_arena *arena, const char *s);
+char		*ft_arena_substr(t_arena *arena, const char *s, unsigned int start,
+				size_t len);
+char		*ft_arena_strjoin(t_arena *arena, const char *s1, const char *s2);
+char		*ft_arena_itoa(t_arena *arena, int n);
+char		**ft_arena_split(t_arena *arena, const char *s, char c);
+t_list		*ft_arena_lstnew(t_arena *arena, void *content);
+void		ft_hmap_init(t_hmap *map, int byte_keys);
+size_t		ft_hmap_size(const t_hmap *map);
+void		ft_hmap_free(t_hmap *map, void (*del)(void *));
+int			ft_hmap_put(t_hmap *map, uint64_t key, void *value);
+void		**ft_hmap_get(t_hmap *map, uint64_t key);
+int			ft_hmap_del(t_hmap *map, uint64_t key, void **value);
+int			ft_hmap_put_bytes(t_hmap *map, const void *key, size_t len,
+				void *value);
+void		**ft_hmap_get_bytes(t_hmap *map, const void *key, size_t len);
+int			ft_hmap_del_bytes(t_hmap *map, const void *key, size_t len,
+				void **value);
 void		ft_free_array(char **array);
 long		ft_atol(const char *str);
+t_cpu_level	ft_cpu_detect(void);
+t_cpu_level	ft_cpu_level(void);
+const char	*ft_cpu_level_name(t_cpu_level level);
+uint32_t	ft_crc32(uint32_t crc, const void *data, size_t n);
+void		ft_byteset_init(t_byteset *set, const char *chars);
+void		ft_byteset_add(t_byteset *set, unsigned char c);
+int			ft_byteset_has(const t_byteset *set, unsigned char c);
+size_t		ft_byteset_span(const t_byteset *set, const void *s, size_t n);
+size_t		ft_byteset_cspan(const t_byteset *set, const void *s, size_t n);
+size_t		ft_byteset_rspan(const t_byteset *set, const void *s, size_t n);
+int			ft_utf8_valid(const char *s, size_t n);
 #endif
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_arena.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:41:00 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:41:00 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_arena_init, ft_arena_alloc, ft_arena_alloc_aligned,
+    ft_arena_reset -- bump allocation from a t_arena
+
+DESCRIPTION
+    A t_arena hands out memory from a chain of chunks of at least
+    `chunk_size` bytes (FT_ARENA_CHUNK when 0 is given) by bumping an offset.
+    Nothing is freed individually: every allocation dies together when the
+    arena is reset, rewound (see ft_arena_scope.c) or released.
+
+    ft_arena_init makes an empty arena; the first chunk is allocated on the
+    first request.
+    ft_arena_alloc returns `size` bytes aligned to FT_ARENA_ALIGN, enough
+    for any scalar type.
+    ft_arena_alloc_aligned returns `size` bytes aligned to `align`, which
+    must be a power of two; 1 packs strings tightly.
+    ft_arena_reset forgets every allocation but keeps the chunks, so the
+    next round of work does not call malloc at all.
+
+RETURN VALUES
+    The allocation functions return the memory, uninitialised, or NULL if
+    a new chunk could not be allocated or `align` is not a power of two.
+
+NOTES
+    - A request larger than a chunk gets a chunk of its own.
+    - Chunks after the current one are always empty; an allocation tries
+      the current chunk, then the next one, and only then calls malloc.
+*/
+void	ft_arena_init(t_arena *arena, size_t chunk_size)
+{
+	if (chunk_size == 0)
+		chunk_size = FT_ARENA_CHUNK;
+	arena->first = NULL;
+	arena->cur = NULL;
+	arena->chunk_size = chunk_size;
+}
+
+/* Address in chunk where size bytes aligned to align fit, or 0 */
+static uintptr_t	fit(t_arena_chunk *chunk, size_t size, size_t align)
+{
+	uintptr_t	start;
+	uintptr_t	p;
+
+	if (!chunk)
+		return (0);
+	start = (uintptr_t)(chunk + 1);
+	p = (start + chunk->used + align - 1) & ~(uintptr_t)(align - 1);
+	if (p - start > chunk->size || size > chunk->size - (p - start))
+		return (0);
+	chunk->used = p + size - start;
+	return (p);
+}
+
+/* Links a fresh chunk able to hold size bytes right after the current one */
+static t_arena_chunk	*add_chunk(t_arena *arena, size_t size, size_t align)
+{
+	t_arena_chunk	*chunk;
+
+	if (size > SIZE_MAX / 2 - align)
+		return (NULL);
+	size += align;
+	if (size < arena->chunk_size)
+		size = arena->chunk_size;
+	chunk = (t_arena_chunk *) malloc(sizeof(t_arena_chunk) + size);
+	if (!chunk)
+		return (NULL);
+	chunk->size = size;
+	chunk->used = 0;
+	chunk->next = NULL;
+	if (arena->cur)
+	{
+		chunk->next = arena->cur->next;
+		arena->cur->next = chunk;
+	}
+	else
+		arena->first = chunk;
+	arena->cur = chunk;
+	return (chunk);
+}
+
+void	*ft_arena_alloc_aligned(t_arena *arena, size_t size, size_t align)
+{
+	uintptr_t	p;
+
+	if (align == 0 || (align & (align - 1)) != 0)
+		return (NULL);
+	p = fit(arena->cur, size, align);
+	if (!p && arena->cur && arena->cur->next)
+	{
+		p = fit(arena->cur->next, size, align);
+		if (p)
+			arena->cur = arena->cur->next;
+	}
+	if (!p && add_chunk(arena, size, align))
+		p = fit(arena->cur, size, align);
+	return ((void *)p);
+}
+
+void	*ft_arena_alloc(t_arena *arena, size_t size)
+{
+	return (ft_arena_alloc_aligned(arena, size, FT_ARENA_ALIGN));
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_arena_scope.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:41:00 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:41:00 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_arena_mark, ft_arena_rewind, ft_arena_reset,
+    ft_arena_release -- scoped lifetimes in a t_arena
+
+DESCRIPTION
+    ft_arena_mark records the current fill level of the arena.
+    ft_arena_rewind frees, in one step, everything allocated since `mark`
+    was taken, keeping the chunks for reuse. Marks nest: rewinding to an
+    outer mark also drops everything after the inner ones.
+    ft_arena_reset rewinds the whole arena.
+    ft_arena_release gives every chunk back with free() and leaves an
+    empty arena with the same chunk size.
+
+NOTES
+    - Only the chunks up to the current one are touched; the ones after
+      it are empty by construction.
+    - A mark is only valid until the arena is rewound past it, reset or
+      released.
+*/
+t_arena_mark	ft_arena_mark(const t_arena *arena)
+{
+	t_arena_mark	mark;
+
+	mark.chunk = arena->cur;
+	mark.used = 0;
+	if (arena->cur)
+		mark.used = arena->cur->used;
+	return (mark);
+}
+
+void	ft_arena_rewind(t_arena *arena, t_arena_mark mark)
+{
+	t_arena_chunk	*chunk;
+
+	if (!mark.chunk)
+	{
+		ft_arena_reset(arena);
+		return ;
+	}
+	chunk = mark.chunk;
+	while (chunk != arena->cur)
+	{
+		chunk = chunk->next;
+		chunk->used = 0;
+	}
+	mark.chunk->used = mark.used;
+	arena->cur = mark.chunk;
+}
+
+void	ft_arena_reset(t_arena *arena)
+{
+	t_arena_chunk	*chunk;
+
+	chunk = arena->first;
+	while (chunk)
+	{
+		chunk->used = 0;
+		if (chunk == arena->cur)
+			break ;
+		chunk = chunk->next;
+	}
+	arena->cur = arena->first;
+}
+
+void	ft_arena_release(t_arena *arena)
+{
+	t_arena_chunk	*next;
+
+	while (arena->first)
+	{
+		next = arena->first->next;
+		free(arena->first);
+		arena->first = next;
+	}
+	ft_arena_init(arena, arena->chunk_size);
+}
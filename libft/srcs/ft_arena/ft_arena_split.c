@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_arena_split.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:41:20 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:47:28 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_arena_split, ft_arena_lstnew -- ft_split and ft_lstnew allocating
+    from a t_arena
+
+DESCRIPTION
+    ft_arena_split splits `s` on runs of `c` like ft_split; the pointer
+    array and every word come from `arena`. The words are found with a
+    t_tokenizer, once to count them (ft_tok_count) and once to copy them.
+
+    ft_arena_lstnew returns a t_list node holding `content`, like
+    ft_lstnew, carved from `arena`.
+
+RETURN VALUES
+    The array or node, or NULL if `s` is NULL or the arena could not grow.
+
+NOTES
+    - Nothing returned here may be passed to free(), ft_free_array,
+      ft_lstdelone or ft_lstclear; it goes away with the arena.
+    - On failure the part already allocated stays in the arena until it
+      is rewound.
+*/
+static int	fill_words(t_arena *arena, char **words, t_tokenizer *tok)
+{
+	const char	*word;
+	size_t		word_len;
+
+	while (ft_tok_next(tok, &word, &word_len))
+	{
+		*words = ft_arena_strndup(arena, word, word_len);
+		if (!*words++)
+			return (-1);
+	}
+	*words = NULL;
+	return (0);
+}
+
+char	**ft_arena_split(t_arena *arena, const char *s, char c)
+{
+	t_tokenizer	tok;
+	char		set[2];
+	char		**words;
+
+	if (!s)
+		return (NULL);
+	set[0] = c;
+	set[1] = '\0';
+	ft_tok_init(&tok, s, ft_strlen(s), set);
+	words = ft_arena_alloc(arena, (ft_tok_count(&tok) + 1) * sizeof(char *));
+	if (!words)
+		return (NULL);
+	if (fill_words(arena, words, &tok) == -1)
+		return (NULL);
+	return (words);
+}
+
+t_list	*ft_arena_lstnew(t_arena *arena, void *content)
+{
+	t_list	*node;
+
+	node = ft_arena_alloc(arena, sizeof(t_list));
+	if (!node)
+		return (NULL);
+	node->content = content;
+	node->next = NULL;
+	return (node);
+}
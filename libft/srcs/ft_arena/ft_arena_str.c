@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_arena_str.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:41:20 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:41:20 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_arena_strndup, ft_arena_strdup, ft_arena_substr, ft_arena_strjoin,
+    ft_arena_itoa -- string helpers that allocate from a t_arena
+
+DESCRIPTION
+    Same results as ft_strndup, ft_strdup, ft_substr, ft_strjoin and
+    ft_itoa, but the strings are bump-allocated from `arena` (packed with
+    alignment 1) instead of malloc'ed. They live until the arena is
+    rewound, reset or released and must not be passed to free().
+
+RETURN VALUES
+    The new string, or NULL if the arena could not grow or an input string
+    is NULL.
+*/
+char	*ft_arena_strndup(t_arena *arena, const char *s, size_t n)
+{
+	char	*copy;
+
+	if (!s)
+		return (NULL);
+	copy = ft_arena_alloc_aligned(arena, n + 1, 1);
+	if (!copy)
+		return (NULL);
+	ft_memcpy(copy, s, n);
+	copy[n] = '\0';
+	return (copy);
+}
+
+char	*ft_arena_strdup(t_arena *arena, const char *s)
+{
+	if (!s)
+		return (NULL);
+	return (ft_arena_strndup(arena, s, ft_strlen(s)));
+}
+
+char	*ft_arena_substr(t_arena *arena, const char *s, unsigned int start,
+		size_t len)
+{
+	size_t	s_len;
+
+	if (!s)
+		return (NULL);
+	s_len = ft_strlen(s);
+	if (start > s_len)
+		start = s_len;
+	if (len > s_len - start)
+		len = s_len - start;
+	return (ft_arena_strndup(arena, s + start, len));
+}
+
+char	*ft_arena_strjoin(t_arena *arena, const char *s1, const char *s2)
+{
+	size_t	len1;
+	size_t	len2;
+	char	*result;
+
+	if (!s1 || !s2)
+		return (NULL);
+	len1 = ft_strlen(s1);
+	len2 = ft_strlen(s2);
+	result = ft_arena_alloc_aligned(arena, len1 + len2 + 1, 1);
+	if (!result)
+		return (NULL);
+	ft_memcpy(result, s1, len1);
+	ft_memcpy(result + len1, s2, len2 + 1);
+	return (result);
+}
+
+char	*ft_arena_itoa(t_arena *arena, int n)
+{
+	char	digits[FT_FMT_BUFSIZE];
+
+	return (ft_arena_strndup(arena, digits, ft_fmt_i64(digits, n)));
+}
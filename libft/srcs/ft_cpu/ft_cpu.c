@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_cpu.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:05:21 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:05:21 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "ft_simd.h"
+
+/*
+NAME
+    ft_cpu_detect, ft_cpu_level, ft_cpu_level_name -- kernel dispatch level
+
+DESCRIPTION
+    ft_cpu_detect queries cpuid for the highest instruction set level the
+    host supports. ft_cpu_level returns the level the library actually
+    dispatches to, which is the detected level unless the FT_CPU_LEVEL
+    environment variable forced a lower one. ft_cpu_level_name gives the
+    name used by FT_CPU_LEVEL for a level.
+
+PARAMETERS
+    level: A t_cpu_level value.
+
+RETURN VALUES
+    ft_cpu_detect and ft_cpu_level return a t_cpu_level.
+    ft_cpu_level_name returns a static string, or "unknown".
+
+NOTES
+    - FT_CPU_AVX2 also requires SSE4.2, so a level always implies every
+      level below it.
+    - Targets other than x86-64 always report FT_CPU_WORD.
+*/
+t_cpu_level	ft_cpu_detect(void)
+{
+	t_cpu_level	level;
+
+	level = FT_CPU_WORD;
+#if FT_X86_SIMD
+
+	__builtin_cpu_init();
+	level = FT_CPU_SSE2;
+	if (__builtin_cpu_supports("sse4.2"))
+		level = FT_CPU_SSE42;
+	if (level == FT_CPU_SSE42 && __builtin_cpu_supports("avx2"))
+		level = FT_CPU_AVX2;
+#endif
+
+	return (level);
+}
+
+t_cpu_level	ft_cpu_level(void)
+{
+	return ((t_cpu_level)ft_dispatch()->level);
+}
+
+const char	*ft_cpu_level_name(t_cpu_level level)
+{
+	static const char	*names[] = {"word", "sse2", "sse4.2", "avx2"};
+
+	if ((int)level < FT_CPU_WORD || level > FT_CPU_AVX2)
+		return ("unknown");
+	return (names[level]);
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_dispatch.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:05:21 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:46:46 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "ft_simd.h"
+#include <sched.h>
+
+/*
+ * Kernel dispatch. The table is filled once, from a constructor at startup
+ * so the first ft_* call never pays for it (and never runs cpuid inside a
+ * signal handler), and lazily from ft_dispatch() for callers that run
+ * before constructors. The first caller claims the table by moving its
+ * state from UNSET to FILLING with a compare-and-swap, fills it in place,
+ * then publishes it as READY. Other callers wait for READY; nobody writes
+ * the table after that, so readers never see it change.
+ *
+ * FT_CPU_LEVEL=word|sse2|sse4.2|avx2 forces a level, e.g. to benchmark the
+ * fallbacks on a newer host. Levels above what the CPU supports are capped.
+ */
+#define FT_CPU_ENV_ERROR	"libft: ignoring unknown FT_CPU_LEVEL\n"
+
+t_ft_dispatch	g_ft_dispatch;
+
+static void	fill_word(t_ft_dispatch *table)
+{
+	table->memcpy = ft_memcpy_word;
+	table->memmove = ft_memmove_word;
+	table->memset = ft_memset_word;
+	table->strlen = ft_strlen_word;
+	table->memchr = ft_memchr_word;
+	table->strchr = ft_strchr_word;
+	table->strrchr = ft_strrchr_word;
+	table->memcmp = ft_memcmp_word;
+	table->strncmp = ft_strncmp_word;
+	table->crc32 = ft_crc32_table;
+	table->utf8_valid = ft_utf8_valid_word;
+	table->byteset_span = ft_byteset_span_word;
+}
+
+#if FT_X86_SIMD
+
+static void	fill_simd(t_ft_dispatch *table, int level)
+{
+	table->memcpy = ft_memcpy_sse2;
+	table->memmove = ft_memmove_sse2;
+	table->memset = ft_memset_sse2;
+	table->strlen = ft_strlen_sse2;
+	table->memchr = ft_memchr_sse2;
+	table->strchr = ft_strchr_sse2;
+	table->strrchr = ft_strrchr_sse2;
+	table->memcmp = ft_memcmp_sse2;
+	table->strncmp = ft_strncmp_sse2;
+	table->utf8_valid = ft_utf8_valid_sse2;
+	if (level >= FT_CPU_SSE42)
+		table->crc32 = ft_crc32_sse42;
+	if (level >= FT_CPU_SSE42)
+		table->byteset_span = ft_byteset_span_sse42;
+	if (level < FT_CPU_AVX2)
+		return ;
+	table->memcpy = ft_memcpy_avx2;
+	table->memmove = ft_memmove_avx2;
+	table->memset = ft_memset_avx2;
+	table->strlen = ft_strlen_avx2;
+	table->memchr = ft_memchr_avx2;
+	table->strchr = ft_strchr_avx2;
+	table->strrchr = ft_strrchr_avx2;
+	table->memcmp = ft_memcmp_avx2;
+	table->strncmp = ft_strncmp_avx2;
+	table->utf8_valid = ft_utf8_valid_avx2;
+	table->byteset_span = ft_byteset_span_avx2;
+}
+#endif
+
+/*
+ * Applies FT_CPU_LEVEL, if set, on top of the detected level. Runs before
+ * the table exists, so it must not call any dispatched ft_* function.
+ */
+static int	forced_level(int detected)
+{
+	const char	*env;
+	int			level;
+
+	env = getenv("FT_CPU_LEVEL");
+	if (!env || !*env)
+		return (detected);
+	level = FT_CPU_WORD;
+	while (level <= FT_CPU_AVX2
+		&& ft_strncmp_word((const unsigned char *)env,
+			(const unsigned char *)ft_cpu_level_name(level), 8) != 0)
+		level++;
+	if (level > FT_CPU_AVX2)
+	{
+		write(2, FT_CPU_ENV_ERROR, sizeof(FT_CPU_ENV_ERROR) - 1);
+		return (detected);
+	}
+	if (level > detected)
+		return (detected);
+	return (level);
+}
+
+/* Spins until the caller that claimed the table has published it */
+static void	wait_published(void)
+{
+	while (__atomic_load_n(&g_ft_dispatch.state, __ATOMIC_ACQUIRE)
+		!= FT_DISPATCH_READY)
+		sched_yield();
+}
+
+void	ft_dispatch_init(void)
+{
+	int	state;
+
+	state = FT_DISPATCH_UNSET;
+	if (!__atomic_compare_exchange_n(&g_ft_dispatch.state, &state,
+			FT_DISPATCH_FILLING, 0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+	{
+		wait_published();
+		return ;
+	}
+	g_ft_dispatch.level = forced_level(ft_cpu_detect());
+	fill_word(&g_ft_dispatch);
+#if FT_X86_SIMD
+
+	if (g_ft_dispatch.level >= FT_CPU_SSE2)
+		fill_simd(&g_ft_dispatch, g_ft_dispatch.level);
+#endif
+
+	__atomic_store_n(&g_ft_dispatch.state, FT_DISPATCH_READY,
+		__ATOMIC_RELEASE);
+}
+
+__attribute__((constructor))
+static void	ft_dispatch_startup(void)
+{
+	if (__atomic_load_n(&g_ft_dispatch.state, __ATOMIC_ACQUIRE)
+		!= FT_DISPATCH_READY)
+		ft_dispatch_init();
+}
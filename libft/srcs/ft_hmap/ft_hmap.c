@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hmap.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:34:32 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:34:32 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hash.h"
+
+/*
+NAME
+    ft_hmap_init, ft_hmap_size, ft_hmap_free -- open-addressing hash map
+
+DESCRIPTION
+    A t_hmap maps integer keys (ft_hmap_put/get/del) or byte-string keys
+    (ft_hmap_put_bytes/get_bytes/del_bytes) to `void *` values. It is a
+    Robin Hood table: one flat array of 32-byte slots, linear probing, and
+    backward-shift deletion, so lookups touch one or two cache lines and
+    deleting never leaves tombstones.
+
+    ft_hmap_init makes an empty map; `byte_keys` selects the key kind for
+    the map's whole life. Nothing is allocated until the first put.
+    ft_hmap_size returns the number of entries.
+    ft_hmap_free calls `del` on every value (when `del` is not NULL) and
+    releases the map, which is left empty and reusable.
+
+NOTES
+    - The table doubles when it would pass 7/8 full, but entries are not
+      rehashed all at once: the old table is kept and every put or del
+      moves the next HMAP_DRAIN_STEPS slots across, with lookups checking
+      both tables meanwhile. No single insert pays for the whole resize.
+    - Byte keys are copied into the map; integer keys are stored as is.
+*/
+void	ft_hmap_init(t_hmap *map, int byte_keys)
+{
+	ft_bzero(map, sizeof(*map));
+	map->bytes = byte_keys;
+}
+
+size_t	ft_hmap_size(const t_hmap *map)
+{
+	return (map->cur.count + map->old.count);
+}
+
+static void	free_table(t_htable *t, int bytes, void (*del)(void *))
+{
+	size_t	i;
+
+	i = 0;
+	while (t->slots && i <= t->mask)
+	{
+		if (t->slots[i].dist != 0 && bytes)
+			free((void *)(uintptr_t)t->slots[i].key);
+		if (t->slots[i].dist != 0 && del)
+			del(t->slots[i].value);
+		i++;
+	}
+	ft_htable_release(t);
+}
+
+void	ft_hmap_free(t_hmap *map, void (*del)(void *))
+{
+	free_table(&map->cur, map->bytes, del);
+	free_table(&map->old, map->bytes, del);
+	ft_hmap_init(map, map->bytes);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hmap_bytes.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:34:32 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:34:32 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hash.h"
+
+/*
+NAME
+    ft_hmap_put_bytes, ft_hmap_get_bytes, ft_hmap_del_bytes -- use a t_hmap
+    with byte-string keys
+
+DESCRIPTION
+    Same as ft_hmap_put, ft_hmap_get and ft_hmap_del (see ft_hmap_keys.c)
+    for maps made with `byte_keys` != 0. The key is the `len` bytes at
+    `key`; put stores a copy of it, so the caller's buffer may be reused.
+*/
+static t_hkey	bytes_key(const void *key, size_t len)
+{
+	t_hkey	hkey;
+
+	hkey.hash = ft_hash_mix(ft_crc32(0, key, len) ^ ((uint64_t)len << 32));
+	hkey.ikey = 0;
+	hkey.bytes = key;
+	hkey.len = len;
+	return (hkey);
+}
+
+int	ft_hmap_put_bytes(t_hmap *map, const void *key, size_t len, void *value)
+{
+	t_hkey	hkey;
+
+	hkey = bytes_key(key, len);
+	return (ft_hmap_insert(map, &hkey, value));
+}
+
+void	**ft_hmap_get_bytes(t_hmap *map, const void *key, size_t len)
+{
+	t_hkey	hkey;
+
+	hkey = bytes_key(key, len);
+	return (ft_hmap_find(map, &hkey));
+}
+
+int	ft_hmap_del_bytes(t_hmap *map, const void *key, size_t len, void **value)
+{
+	t_hkey	hkey;
+
+	hkey = bytes_key(key, len);
+	return (ft_hmap_remove(map, &hkey, value));
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hmap_keys.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:34:32 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:34:32 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hash.h"
+
+/*
+NAME
+    ft_hmap_put, ft_hmap_get, ft_hmap_del, ft_hmap_put_bytes,
+    ft_hmap_get_bytes, ft_hmap_del_bytes -- use a t_hmap
+
+DESCRIPTION
+    The plain functions take an integer key such as a PID and are for maps
+    made with `byte_keys` == 0; the _bytes functions take `len` bytes at
+    `key` and are for maps made with `byte_keys` != 0.
+
+    put stores `value` under the key, replacing any previous value.
+    get finds the key.
+    del removes the key and stores its value in `*value` (when `value` is
+    not NULL) so that the caller can release it.
+
+RETURN VALUES
+    put returns 0, or -1 if memory could not be allocated.
+    get returns a pointer to the stored value, which the caller may read or
+    overwrite until the next put or del, or NULL if the key is absent.
+    del returns 1 if the key was removed and 0 if it was absent.
+
+NOTES
+    - Integer keys are hashed with the splitmix64 finalizer, byte keys
+      with ft_crc32 (hardware CRC-32C where available) mixed the same way.
+*/
+static t_hkey	int_key(uint64_t key)
+{
+	t_hkey	hkey;
+
+	hkey.hash = ft_hash_mix(key);
+	hkey.ikey = key;
+	hkey.bytes = NULL;
+	hkey.len = 0;
+	return (hkey);
+}
+
+int	ft_hmap_put(t_hmap *map, uint64_t key, void *value)
+{
+	t_hkey	hkey;
+
+	hkey = int_key(key);
+	return (ft_hmap_insert(map, &hkey, value));
+}
+
+void	**ft_hmap_get(t_hmap *map, uint64_t key)
+{
+	t_hkey	hkey;
+
+	hkey = int_key(key);
+	return (ft_hmap_find(map, &hkey));
+}
+
+int	ft_hmap_del(t_hmap *map, uint64_t key, void **value)
+{
+	t_hkey	hkey;
+
+	hkey = int_key(key);
+	return (ft_hmap_remove(map, &hkey, value));
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hmap_ops.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:34:32 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:34:32 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hash.h"
+
+/*
+NAME
+    ft_hmap_find, ft_hmap_insert, ft_hmap_remove -- t_hmap operations on a
+    prepared key
+
+DESCRIPTION
+    The shared bodies of the integer and byte-key entry points. A key may
+    sit in the current table or, while a resize is draining, in the old
+    one; both are searched. Insertions always go to the current table.
+    Puts and dels advance the drain first.
+*/
+static t_hslot	*lookup(t_hmap *map, const t_hkey *key, t_htable **table)
+{
+	ssize_t	i;
+
+	*table = &map->cur;
+	i = ft_htable_find(&map->cur, key, map->bytes);
+	if (i < 0 && map->old.slots)
+	{
+		*table = &map->old;
+		i = ft_htable_find(&map->old, key, map->bytes);
+	}
+	if (i < 0)
+		return (NULL);
+	return (&(*table)->slots[i]);
+}
+
+void	**ft_hmap_find(t_hmap *map, const t_hkey *key)
+{
+	t_htable	*table;
+	t_hslot		*slot;
+
+	slot = lookup(map, key, &table);
+	if (!slot)
+		return (NULL);
+	return (&slot->value);
+}
+
+int	ft_hmap_insert(t_hmap *map, const t_hkey *key, void *value)
+{
+	t_htable	*table;
+	t_hslot		*found;
+	t_hslot		slot;
+
+	ft_hmap_drain(map, HMAP_DRAIN_STEPS);
+	found = lookup(map, key, &table);
+	if (found)
+	{
+		found->value = value;
+		return (0);
+	}
+	if (key->len > UINT32_MAX || ft_hmap_reserve(map) == -1)
+		return (-1);
+	slot.hash = key->hash;
+	slot.key = key->ikey;
+	slot.key_len = key->len;
+	slot.value = value;
+	if (map->bytes)
+	{
+		slot.key = (uintptr_t) malloc(key->len + 1);
+		if (!slot.key)
+			return (-1);
+		ft_memcpy((void *)(uintptr_t)slot.key, key->bytes, key->len);
+	}
+	ft_htable_place(&map->cur, slot);
+	return (0);
+}
+
+int	ft_hmap_remove(t_hmap *map, const t_hkey *key, void **value)
+{
+	t_htable	*table;
+	t_hslot		*slot;
+
+	ft_hmap_drain(map, HMAP_DRAIN_STEPS);
+	slot = lookup(map, key, &table);
+	if (!slot)
+		return (0);
+	if (value)
+		*value = slot->value;
+	if (map->bytes)
+		free((void *)(uintptr_t)slot->key);
+	ft_htable_remove(table, slot - table->slots);
+	return (1);
+}
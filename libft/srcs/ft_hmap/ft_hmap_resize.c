@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hmap_resize.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:34:32 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:34:32 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hash.h"
+
+/*
+NAME
+    ft_hmap_reserve, ft_hmap_drain -- incremental resizing of a t_hmap
+
+DESCRIPTION
+    ft_hmap_reserve makes room for one more entry. When the current table
+    would pass 7/8 full it becomes the `old` table and an empty one twice
+    its size takes its place.
+
+    ft_hmap_drain moves up to `steps` entries of the old table into the
+    current one, walking it from slot 0 with the `drain` cursor, and frees
+    it once it is empty. Entries are taken out with ft_htable_remove, so the
+    old table stays a valid Robin Hood table that lookups can still search.
+    The cursor only advances past empty slots: a removal may shift the next
+    entry back onto it.
+
+RETURN VALUES
+    ft_hmap_reserve returns 0, or -1 if the new table could not be allocated.
+
+NOTES
+    - Draining HMAP_DRAIN_STEPS slots per put/del empties the old table
+      long before the new one fills up, so a resize never has to wait for
+      the previous one; the complete drain in ft_hmap_reserve only guards
+      that invariant.
+*/
+void	ft_hmap_drain(t_hmap *map, size_t steps)
+{
+	t_hslot	*slot;
+
+	while (map->old.slots && steps-- > 0)
+	{
+		if (map->old.count == 0 || map->drain > map->old.mask)
+		{
+			ft_htable_release(&map->old);
+			return ;
+		}
+		slot = &map->old.slots[map->drain];
+		if (slot->dist == 0)
+			map->drain++;
+		else
+		{
+			ft_htable_place(&map->cur, *slot);
+			ft_htable_remove(&map->old, map->drain);
+		}
+	}
+}
+
+int	ft_hmap_reserve(t_hmap *map)
+{
+	t_htable	fresh;
+	size_t		size;
+
+	size = HMAP_MIN_SLOTS;
+	if (map->cur.slots)
+	{
+		size = (map->cur.mask + 1);
+		if ((map->cur.count + 1) * 8 <= size * 7)
+			return (0);
+		size *= 2;
+	}
+	ft_hmap_drain(map, SIZE_MAX);
+	if (ft_htable_alloc(&fresh, size) == -1)
+		return (-1);
+	map->old = map->cur;
+	map->cur = fresh;
+	map->drain = 0;
+	return (0);
+}
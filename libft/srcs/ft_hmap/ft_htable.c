@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_htable.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:34:31 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:34:31 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_hash.h"
+#include "ft_map.h"
+
+/*
+NAME
+    ft_htable_find, ft_htable_place, ft_htable_remove -- Robin Hood table
+    primitives behind t_hmap
+
+DESCRIPTION
+    A t_htable is a power-of-two array of slots probed linearly from
+    `hash & mask`. Each slot records its probe distance plus one in `dist`
+    (0 marks an empty slot). Insertion keeps the Robin Hood order: an entry
+    that has travelled further takes the slot of one that has not, so probe
+    lengths stay short and even at high load.
+
+    ft_htable_find returns the index of the slot holding `key`, or -1. The
+    search stops as soon as it meets a slot closer to home than the probe.
+    ft_htable_place inserts a slot whose key is known to be absent.
+    ft_htable_remove deletes slot `i` by shifting the following displaced
+    entries back by one, so no tombstones are left behind.
+    ft_htable_alloc and ft_htable_release create and destroy the slot
+    array. Arrays past FT_MAP_THRESHOLD are mapped rather than calloc'ed:
+    the kernel supplies zero pages on first touch, so a resize does not
+    stall while a large table is cleared.
+*/
+static int	slot_matches(const t_hslot *s, const t_hkey *key, int bytes)
+{
+	if (s->hash != key->hash)
+		return (0);
+	if (!bytes)
+		return (s->key == key->ikey);
+	return (s->key_len == key->len
+		&& ft_memcmp((const void *)(uintptr_t)s->key, key->bytes,
+			key->len) == 0);
+}
+
+ssize_t	ft_htable_find(const t_htable *t, const t_hkey *key, int bytes)
+{
+	size_t		i;
+	uint32_t	dist;
+
+	if (!t->slots)
+		return (-1);
+	i = key->hash & t->mask;
+	dist = 1;
+	while (t->slots[i].dist >= dist)
+	{
+		if (slot_matches(&t->slots[i], key, bytes))
+			return (i);
+		i = (i + 1) & t->mask;
+		dist++;
+	}
+	return (-1);
+}
+
+void	ft_htable_place(t_htable *t, t_hslot slot)
+{
+	t_hslot	evicted;
+	size_t	i;
+
+	i = slot.hash & t->mask;
+	slot.dist = 1;
+	while (t->slots[i].dist != 0)
+	{
+		if (t->slots[i].dist < slot.dist)
+		{
+			evicted = t->slots[i];
+			t->slots[i] = slot;
+			slot = evicted;
+		}
+		i = (i + 1) & t->mask;
+		slot.dist++;
+	}
+	t->slots[i] = slot;
+	t->count++;
+}
+
+void	ft_htable_remove(t_htable *t, size_t i)
+{
+	size_t	next;
+
+	next = (i + 1) & t->mask;
+	while (t->slots[next].dist > 1)
+	{
+		t->slots[i] = t->slots[next];
+		t->slots[i].dist--;
+		i = next;
+		next = (next + 1) & t->mask;
+	}
+	t->slots[i].dist = 0;
+	t->count--;
+}
+
+int	ft_htable_alloc(t_htable *t, size_t size)
+{
+	if (size * sizeof(t_hslot) > FT_MAP_THRESHOLD)
+		t->slots = ft_map_alloc(ft_map_round(size * sizeof(t_hslot)));
+	else
+		t->slots = (t_hslot *) ft_calloc(size, sizeof(t_hslot));
+	if (!t->slots)
+		return (-1);
+	t->mask = size - 1;
+	t->count = 0;
+	return (0);
+}
+
+void	ft_htable_release(t_htable *t)
+{
+	size_t	bytes;
+
+	bytes = (t->mask + 1) * sizeof(t_hslot);
+	if (t->slots && bytes > FT_MAP_THRESHOLD)
+		ft_map_free(t->slots, ft_map_round(bytes));
+	else
+		free(t->slots);
+	ft_bzero(t, sizeof(*t));
+}
@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/28 14:44:25 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:51:28 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:32:02 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -30,6 +30,7 @@ RETURN VALUES
 NOTES
     - If `lst` is NULL or `new` is NULL, the function does nothing.
     - If the list is empty, `new` becomes the head of the list.
+    - Finding the tail walks the list; use a t_lstq to append in a loop.
 */
 void	ft_lstadd_back(t_list **lst, t_list *new)
 {
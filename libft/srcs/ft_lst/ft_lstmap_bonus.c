@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/29 13:55:56 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/10 00:10:25 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:32:02 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -33,16 +33,20 @@ RETURN VALUES
 NOTES
     - The function does not modify the original list.
     - The `f` function should allocate memory for the new content if needed.
+    - The tail of the new list is tracked while it is built, so the copy
+      is O(n) rather than a walk to the end for every node.
 */
 t_list	*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *))
 {
 	t_list	*new_list;
 	t_list	*new_node;
+	t_list	*tail;
 	void	*new_content;
 
 	if (!lst || !f)
 		return (NULL);
 	new_list = NULL;
+	tail = NULL;
 	while (lst)
 	{
 		new_content = f(lst->content);
@@ -53,7 +57,11 @@ t_list	*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *))
 			ft_lstclear(&new_list, del);
 			return (NULL);
 		}
-		ft_lstadd_back(&new_list, new_node);
+		if (tail)
+			tail->next = new_node;
+		else
+			new_list = new_node;
+		tail = new_node;
 		lst = lst->next;
 	}
 	return (new_list);
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_lstpool.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:31:11 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:31:11 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_lstpool_init, ft_lstpool_new, ft_lstpool_release,
+    ft_lstpool_destroy -- allocate list nodes from a pool
+
+DESCRIPTION
+    A t_lstpool hands out t_list nodes carved from blocks of
+    FT_LSTPOOL_BLOCK nodes, so building a list costs one malloc per block
+    instead of one per node. Released nodes go on a free list and are
+    handed out again before the current block is touched.
+
+    ft_lstpool_init prepares an empty pool.
+    ft_lstpool_new returns a node holding `content`, like ft_lstnew.
+    ft_lstpool_release returns a node to the pool; its content is untouched.
+    ft_lstpool_destroy frees every block at once, live nodes included.
+
+RETURN VALUES
+    ft_lstpool_new returns the node, or NULL if a new block could not be
+    allocated.
+
+NOTES
+    - Pool nodes are ordinary t_list nodes for ft_lstiter, ft_lstlast and
+      the like, but must never be passed to free(), ft_lstdelone or
+      ft_lstclear.
+*/
+void	ft_lstpool_init(t_lstpool *pool)
+{
+	pool->blocks = NULL;
+	pool->free = NULL;
+	pool->carved = FT_LSTPOOL_BLOCK;
+}
+
+t_list	*ft_lstpool_new(t_lstpool *pool, void *content)
+{
+	t_lstblock	*block;
+	t_list		*node;
+
+	node = pool->free;
+	if (node)
+		pool->free = node->next;
+	else
+	{
+		if (pool->carved == FT_LSTPOOL_BLOCK)
+		{
+			block = (t_lstblock *) malloc(sizeof(t_lstblock));
+			if (!block)
+				return (NULL);
+			block->next = pool->blocks;
+			pool->blocks = block;
+			pool->carved = 0;
+		}
+		node = &pool->blocks->nodes[pool->carved++];
+	}
+	node->content = content;
+	node->next = NULL;
+	return (node);
+}
+
+void	ft_lstpool_release(t_lstpool *pool, t_list *node)
+{
+	node->next = pool->free;
+	pool->free = node;
+}
+
+void	ft_lstpool_destroy(t_lstpool *pool)
+{
+	t_lstblock	*next;
+
+	while (pool->blocks)
+	{
+		next = pool->blocks->next;
+		free(pool->blocks);
+		pool->blocks = next;
+	}
+	ft_lstpool_init(pool);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_lstq.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:31:11 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:31:11 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_lstq_init, ft_lstq_push, ft_lstq_append, ft_lstq_pop,
+    ft_lstq_splice -- t_list queue with a tail pointer and a count
+
+DESCRIPTION
+    A t_lstq keeps the head, the tail and the number of nodes of a t_list,
+    so appending, measuring and concatenating are O(1) instead of a walk to
+    the tail. `head` is an ordinary NULL-terminated list that the other
+    ft_lst* functions can read.
+
+    ft_lstq_init makes an empty queue whose nodes come from `pool`, or from
+    malloc when `pool` is NULL.
+    ft_lstq_push appends a new node holding `content`.
+    ft_lstq_append appends an existing node.
+    ft_lstq_pop removes the first node, releases it and returns its content.
+    ft_lstq_splice moves every node of `src` to the end of `dst`, leaving
+    `src` empty.
+
+RETURN VALUES
+    ft_lstq_push returns 0, or -1 if no node could be allocated.
+    ft_lstq_pop returns the content of the removed node, or NULL if the
+    queue is empty (check ft_lstq_size when NULL is valid content).
+
+NOTES
+    - Queues that splice into each other must share their node source.
+*/
+void	ft_lstq_init(t_lstq *q, t_lstpool *pool)
+{
+	q->head = NULL;
+	q->tail = NULL;
+	q->count = 0;
+	q->pool = pool;
+}
+
+void	ft_lstq_append(t_lstq *q, t_list *node)
+{
+	node->next = NULL;
+	if (q->tail)
+		q->tail->next = node;
+	else
+		q->head = node;
+	q->tail = node;
+	q->count++;
+}
+
+int	ft_lstq_push(t_lstq *q, void *content)
+{
+	t_list	*node;
+
+	if (q->pool)
+		node = ft_lstpool_new(q->pool, content);
+	else
+		node = ft_lstnew(content);
+	if (!node)
+		return (-1);
+	ft_lstq_append(q, node);
+	return (0);
+}
+
+void	*ft_lstq_pop(t_lstq *q)
+{
+	t_list	*node;
+	void	*content;
+
+	node = q->head;
+	if (!node)
+		return (NULL);
+	q->head = node->next;
+	if (!q->head)
+		q->tail = NULL;
+	q->count--;
+	content = node->content;
+	if (q->pool)
+		ft_lstpool_release(q->pool, node);
+	else
+		free(node);
+	return (content);
+}
+
+void	ft_lstq_splice(t_lstq *dst, t_lstq *src)
+{
+	if (!src->head)
+		return ;
+	if (dst->tail)
+		dst->tail->next = src->head;
+	else
+		dst->head = src->head;
+	dst->tail = src->tail;
+	dst->count += src->count;
+	src->head = NULL;
+	src->tail = NULL;
+	src->count = 0;
+}
@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_lstq_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:31:12 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:31:12 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_lstq_size, ft_lstq_clear -- inspect and empty a t_lstq
+
+DESCRIPTION
+    ft_lstq_size returns the number of nodes in the queue without walking
+    it. ft_lstq_clear calls `del` on the content of every node (when `del`
+    is not NULL), releases the nodes and leaves the queue empty.
+*/
+size_t	ft_lstq_size(const t_lstq *q)
+{
+	return (q->count);
+}
+
+void	ft_lstq_clear(t_lstq *q, void (*del)(void *))
+{
+	void	*content;
+
+	while (q->head)
+	{
+		content = ft_lstq_pop(q);
+		if (del)
+			del(content);
+	}
+}
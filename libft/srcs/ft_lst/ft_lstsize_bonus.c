@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/28 14:09:16 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:37:16 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:32:02 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -28,6 +28,7 @@ RETURN VALUES
 
 NOTES
     - If `lst` is NULL, the function returns 0.
+    - The list is walked; ft_lstq_size answers in O(1) for a t_lstq.
 
 */
 int	ft_lstsize(t_list *lst)
@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/26 17:04:36 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:09:29 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 12:58:26 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,15 +26,12 @@ PARAMETERS
     
 RETURN VALUES
     None. This function does not return a value.
+
+NOTES
+    - Implemented on top of ft_memset, so it shares its word and vector
+      kernels.
 */
 void	ft_bzero(void *s, size_t n)
 {
-	char	*temp_ptr;
-
-	temp_ptr = (char *) s;
-	while (n > 0)
-	{
-		*(temp_ptr++) = 0;
-		n--;
-	}
+	ft_memset(s, 0, n);
 }
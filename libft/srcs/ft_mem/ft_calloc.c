@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/27 18:38:46 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:09:19 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:37:45 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -38,16 +38,13 @@ NOTES
 */
 void	*ft_calloc(size_t nmemb, size_t size)
 {
-	size_t			i;
 	unsigned char	*temp;
 
 	if (nmemb != 0 && size > __SIZE_MAX__ / nmemb)
 		return (NULL);
-	i = 0;
 	temp = malloc(nmemb * size);
 	if (!temp)
 		return (NULL);
-	while (i < nmemb * size)
-		((unsigned char *)temp)[i++] = 0;
+	ft_bzero(temp, nmemb * size);
 	return (temp);
 }
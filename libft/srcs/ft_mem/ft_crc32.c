@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_crc32.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:05:39 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:05:39 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "ft_simd.h"
+
+/*
+NAME
+    ft_crc32 -- CRC-32C checksum of a memory area
+
+DESCRIPTION
+    The ft_crc32 function updates the running checksum `crc` with the first
+    `n` bytes of `data` and returns the new checksum. Pass 0 for the first
+    block and the previous result for every following one; checksumming a
+    buffer in pieces gives the same result as in one call.
+
+PARAMETERS
+    crc: The checksum of the preceding data, or 0.
+    data: Pointer to the bytes to checksum.
+    n: Number of bytes.
+
+RETURN VALUES
+    Returns the updated checksum. ft_crc32(0, "123456789", 9) is 0xE3069283.
+
+NOTES
+    - The polynomial is CRC-32C (Castagnoli, 0x1EDC6F41), the one the SSE4.2
+      crc32 instruction implements, so hosts with SSE4.2 use the instruction
+      and others fall back to a slicing-by-8 table.
+    - The result does not match zlib's crc32, which uses another polynomial.
+*/
+
+#define CRC32C_POLY	0x82F63B78u
+
+static uint32_t	g_crc_table[8][256];
+static int		g_crc_ready;
+
+static void	build_tables(void)
+{
+	uint32_t	crc;
+	int			i;
+	int			k;
+
+	i = -1;
+	while (++i < 256)
+	{
+		crc = i;
+		k = -1;
+		while (++k < 8)
+			crc = (crc >> 1) ^ (CRC32C_POLY & -(crc & 1));
+		g_crc_table[0][i] = crc;
+	}
+	i = -1;
+	while (++i < 256)
+	{
+		k = 0;
+		while (++k < 8)
+			g_crc_table[k][i] = (g_crc_table[k - 1][i] >> 8)
+				^ g_crc_table[0][g_crc_table[k - 1][i] & 0xFF];
+	}
+	__atomic_store_n(&g_crc_ready, 1, __ATOMIC_RELEASE);
+}
+
+/* Folds 8 bytes into crc; byte loads keep it independent of endianness */
+static uint32_t	crc_slice8(uint32_t crc, const unsigned char *s)
+{
+	crc ^= (uint32_t)s[0] | (uint32_t)s[1] << 8
+		| (uint32_t)s[2] << 16 | (uint32_t)s[3] << 24;
+	return (g_crc_table[7][crc & 0xFF] ^ g_crc_table[6][(crc >> 8) & 0xFF]
+		^ g_crc_table[5][(crc >> 16) & 0xFF] ^ g_crc_table[4][crc >> 24]
+		^ g_crc_table[3][s[4]] ^ g_crc_table[2][s[5]]
+		^ g_crc_table[1][s[6]] ^ g_crc_table[0][s[7]]);
+}
+
+/* Table kernel; works on the raw (pre-inverted) CRC register */
+uint32_t	ft_crc32_table(uint32_t crc, const unsigned char *s, size_t n)
+{
+	if (!__atomic_load_n(&g_crc_ready, __ATOMIC_ACQUIRE))
+		build_tables();
+	while (n >= 8)
+	{
+		crc = crc_slice8(crc, s);
+		s += 8;
+		n -= 8;
+	}
+	while (n-- > 0)
+		crc = (crc >> 8) ^ g_crc_table[0][(crc ^ *s++) & 0xFF];
+	return (crc);
+}
+
+uint32_t	ft_crc32(uint32_t crc, const void *data, size_t n)
+{
+	if (!data || n == 0)
+		return (crc);
+	return (~ft_dispatch()->crc32(~crc, (const unsigned char *)data, n));
+}
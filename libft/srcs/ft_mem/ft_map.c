@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_map.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:25:35 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:25:35 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifdef __linux__
+# define _GNU_SOURCE
+#endif
+#include <sys/mman.h>
+#include <unistd.h>
+#include "libft.h"
+#include "ft_map.h"
+
+/*
+NAME
+    ft_map_alloc, ft_map_resize, ft_map_discard, ft_map_free,
+    ft_map_round -- page-mapped storage for large buffers
+
+DESCRIPTION
+    ft_map_alloc maps `size` bytes of zeroed anonymous memory and asks for
+    transparent huge pages on it. ft_map_resize grows or shrinks a mapping,
+    keeping its contents; the block may move. ft_map_discard gives the pages
+    of a mapping back to the kernel but keeps the address range; the
+    contents are lost. ft_map_free unmaps it.
+
+    Sizes passed to these functions must be multiples of the page size;
+    ft_map_round rounds a size up to one.
+
+RETURN VALUES
+    ft_map_alloc and ft_map_resize return the block, or NULL on failure, in
+    which case the original mapping is left untouched.
+
+NOTES
+    - On Linux ft_map_resize is mremap(MREMAP_MAYMOVE): the kernel moves
+      page table entries, so growing costs nothing per byte already stored.
+      Elsewhere it falls back to map, copy and unmap.
+    - MADV_HUGEPAGE is only a hint and is silently ignored where the kernel
+      lacks it or has transparent huge pages disabled.
+*/
+size_t	ft_map_round(size_t size)
+{
+	size_t	page;
+
+	page = (size_t) sysconf(_SC_PAGESIZE);
+	return ((size + page - 1) & ~(page - 1));
+}
+
+void	*ft_map_alloc(size_t size)
+{
+	void	*p;
+
+	p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON,
+			-1, 0);
+	if (p == MAP_FAILED)
+		return (NULL);
+#ifdef MADV_HUGEPAGE
+	madvise(p, size, MADV_HUGEPAGE);
+#endif
+	return (p);
+}
+
+void	*ft_map_resize(void *p, size_t old_size, size_t new_size)
+{
+	void	*q;
+
+#ifdef MREMAP_MAYMOVE
+	q = mremap(p, old_size, new_size, MREMAP_MAYMOVE);
+	if (q == MAP_FAILED)
+		return (NULL);
+# ifdef MADV_HUGEPAGE
+	if (new_size > old_size)
+		madvise(q, new_size, MADV_HUGEPAGE);
+# endif
+#else
+	q = ft_map_alloc(new_size);
+	if (!q)
+		return (NULL);
+	if (old_size < new_size)
+		ft_memcpy(q, p, old_size);
+	else
+		ft_memcpy(q, p, new_size);
+	munmap(p, old_size);
+#endif
+	return (q);
+}
+
+void	ft_map_discard(void *p, size_t size)
+{
+	madvise(p, size, MADV_DONTNEED);
+}
+
+void	ft_map_free(void *p, size_t size)
+{
+	munmap(p, size);
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_mem_avx2.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:40:44 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 12:40:44 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "ft_simd.h"
+
+/*
+ * AVX2 kernels for ft_memcpy, ft_memmove and ft_memset. Every kernel needs
+ * n >= 32. The first and last 32 bytes are handled with unaligned vectors
+ * captured up front; the body between them is moved with aligned stores to
+ * the destination, four vectors per iteration.
+ * Compiled for AVX2 through a target attribute so the rest of the library
+ * keeps the baseline ISA; callers must check CPU support first.
+ */
+#if FT_X86_SIMD
+
+/* Four loads, then four aligned stores: d must be 32-byte aligned */
+FT_AVX2
+static inline void	copy128(unsigned char *d, const unsigned char *s)
+{
+	__m256i	a;
+	__m256i	b;
+	__m256i	c;
+	__m256i	e;
+
+	a = _mm256_loadu_si256((const __m256i *)s);
+	b = _mm256_loadu_si256((const __m256i *)s + 1);
+	c = _mm256_loadu_si256((const __m256i *)s + 2);
+	e = _mm256_loadu_si256((const __m256i *)s + 3);
+	_mm256_store_si256((__m256i *)d, a);
+	_mm256_store_si256((__m256i *)d + 1, b);
+	_mm256_store_si256((__m256i *)d + 2, c);
+	_mm256_store_si256((__m256i *)d + 3, e);
+}
+
+FT_AVX2
+void	ft_memcpy_avx2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m256i			head;
+	__m256i			tail;
+	__m256i			v;
+	unsigned char	*end;
+	size_t			skip;
+
+	head = _mm256_loadu_si256((const __m256i *)s);
+	tail = _mm256_loadu_si256((const __m256i *)(s + n - 32));
+	end = d + n;
+	skip = 32 - ((uintptr_t)d & 31);
+	_mm256_storeu_si256((__m256i *)d, head);
+	d += skip;
+	s += skip;
+	n -= skip;
+	while (n >= 128)
+	{
+		copy128(d, s);
+		d += 128;
+		s += 128;
+		n -= 128;
+	}
+	while (n >= 32)
+	{
+		v = _mm256_loadu_si256((const __m256i *)s);
+		_mm256_store_si256((__m256i *)d, v);
+		d += 32;
+		s += 32;
+		n -= 32;
+	}
+	_mm256_storeu_si256((__m256i *)(end - 32), tail);
+}
+
+/*
+ * Walks upwards; only valid when the destination does not start inside the
+ * source. Each vector is loaded before the stores that could clobber it.
+ */
+FT_AVX2
+static void	move_forward(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m256i			head;
+	__m256i			tail;
+	__m256i			v;
+	unsigned char	*start;
+	size_t			skip;
+
+	head = _mm256_loadu_si256((const __m256i *)s);
+	tail = _mm256_loadu_si256((const __m256i *)(s + n - 32));
+	start = d;
+	skip = 32 - ((uintptr_t)d & 31);
+	d += skip;
+	s += skip;
+	n -= skip;
+	while (n >= 32)
+	{
+		v = _mm256_loadu_si256((const __m256i *)s);
+		_mm256_store_si256((__m256i *)d, v);
+		d += 32;
+		s += 32;
+		n -= 32;
+	}
+	_mm256_storeu_si256((__m256i *)(d + n - 32), tail);
+	_mm256_storeu_si256((__m256i *)start, head);
+}
+
+/* Mirror of move_forward, walking down from the aligned end of d */
+FT_AVX2
+static void	move_backward(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m256i			head;
+	__m256i			tail;
+	__m256i			v;
+	unsigned char	*end;
+	size_t			skip;
+
+	head = _mm256_loadu_si256((const __m256i *)s);
+	tail = _mm256_loadu_si256((const __m256i *)(s + n - 32));
+	end = d + n;
+	skip = (uintptr_t)end & 31;
+	if (skip == 0)
+		skip = 32;
+	n -= skip;
+	while (n >= 32)
+	{
+		n -= 32;
+		v = _mm256_loadu_si256((const __m256i *)(s + n));
+		_mm256_store_si256((__m256i *)(d + n), v);
+	}
+	_mm256_storeu_si256((__m256i *)d, head);
+	_mm256_storeu_si256((__m256i *)(end - 32), tail);
+}
+
+FT_AVX2
+void	ft_memmove_avx2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	if ((uintptr_t)d - (uintptr_t)s >= n)
+		move_forward(d, s, n);
+	else
+		move_backward(d, s, n);
+}
+
+FT_AVX2
+void	ft_memset_avx2(unsigned char *d, unsigned char c, size_t n)
+{
+	__m256i			v;
+	unsigned char	*end;
+
+	v = _mm256_set1_epi8((char)c);
+	end = d + n;
+	_mm256_storeu_si256((__m256i *)d, v);
+	_mm256_storeu_si256((__m256i *)(end - 32), v);
+	d = (unsigned char *)(((uintptr_t)d + 32) & ~(uintptr_t)31);
+	while (d + 128 <= end)
+	{
+		_mm256_store_si256((__m256i *)d, v);
+		_mm256_store_si256((__m256i *)d + 1, v);
+		_mm256_store_si256((__m256i *)d + 2, v);
+		_mm256_store_si256((__m256i *)d + 3, v);
+		d += 128;
+	}
+	while (d + 32 <= end)
+	{
+		_mm256_store_si256((__m256i *)d, v);
+		d += 32;
+	}
+}
+
+#endif
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_mem_sse2.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:40:44 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 12:40:44 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd.h"
+
+/*
+ * SSE2 kernels for ft_memcpy, ft_memmove and ft_memset. Every kernel needs
+ * n >= 16. The first and last 16 bytes are handled with unaligned vectors
+ * captured up front; the body between them is moved with aligned stores to
+ * the destination, four vectors per iteration.
+ */
+#if FT_X86_SIMD
+
+/* Four loads, then four aligned stores: d must be 16-byte aligned */
+static inline void	copy64(unsigned char *d, const unsigned char *s)
+{
+	__m128i	a;
+	__m128i	b;
+	__m128i	c;
+	__m128i	e;
+
+	a = _mm_loadu_si128((const __m128i *)s);
+	b = _mm_loadu_si128((const __m128i *)s + 1);
+	c = _mm_loadu_si128((const __m128i *)s + 2);
+	e = _mm_loadu_si128((const __m128i *)s + 3);
+	_mm_store_si128((__m128i *)d, a);
+	_mm_store_si128((__m128i *)d + 1, b);
+	_mm_store_si128((__m128i *)d + 2, c);
+	_mm_store_si128((__m128i *)d + 3, e);
+}
+
+void	ft_memcpy_sse2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m128i			head;
+	__m128i			tail;
+	__m128i			v;
+	unsigned char	*end;
+	size_t			skip;
+
+	head = _mm_loadu_si128((const __m128i *)s);
+	tail = _mm_loadu_si128((const __m128i *)(s + n - 16));
+	end = d + n;
+	skip = 16 - ((uintptr_t)d & 15);
+	_mm_storeu_si128((__m128i *)d, head);
+	d += skip;
+	s += skip;
+	n -= skip;
+	while (n >= 64)
+	{
+		copy64(d, s);
+		d += 64;
+		s += 64;
+		n -= 64;
+	}
+	while (n >= 16)
+	{
+		v = _mm_loadu_si128((const __m128i *)s);
+		_mm_store_si128((__m128i *)d, v);
+		d += 16;
+		s += 16;
+		n -= 16;
+	}
+	_mm_storeu_si128((__m128i *)(end - 16), tail);
+}
+
+/*
+ * Walks upwards; only valid when the destination does not start inside the
+ * source. Each vector is loaded before the stores that could clobber it.
+ */
+static void	move_forward(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m128i			head;
+	__m128i			tail;
+	__m128i			v;
+	unsigned char	*start;
+	size_t			skip;
+
+	head = _mm_loadu_si128((const __m128i *)s);
+	tail = _mm_loadu_si128((const __m128i *)(s + n - 16));
+	start = d;
+	skip = 16 - ((uintptr_t)d & 15);
+	d += skip;
+	s += skip;
+	n -= skip;
+	while (n >= 16)
+	{
+		v = _mm_loadu_si128((const __m128i *)s);
+		_mm_store_si128((__m128i *)d, v);
+		d += 16;
+		s += 16;
+		n -= 16;
+	}
+	_mm_storeu_si128((__m128i *)(d + n - 16), tail);
+	_mm_storeu_si128((__m128i *)start, head);
+}
+
+/* Mirror of move_forward, walking down from the aligned end of d */
+static void	move_backward(unsigned char *d, const unsigned char *s, size_t n)
+{
+	__m128i			head;
+	__m128i			tail;
+	__m128i			v;
+	unsigned char	*end;
+	size_t			skip;
+
+	head = _mm_loadu_si128((const __m128i *)s);
+	tail = _mm_loadu_si128((const __m128i *)(s + n - 16));
+	end = d + n;
+	skip = (uintptr_t)end & 15;
+	if (skip == 0)
+		skip = 16;
+	n -= skip;
+	while (n >= 16)
+	{
+		n -= 16;
+		v = _mm_loadu_si128((const __m128i *)(s + n));
+		_mm_store_si128((__m128i *)(d + n), v);
+	}
+	_mm_storeu_si128((__m128i *)d, head);
+	_mm_storeu_si128((__m128i *)(end - 16), tail);
+}
+
+void	ft_memmove_sse2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	if ((uintptr_t)d - (uintptr_t)s >= n)
+		move_forward(d, s, n);
+	else
+		move_backward(d, s, n);
+}
+
+void	ft_memset_sse2(unsigned char *d, unsigned char c, size_t n)
+{
+	__m128i			v;
+	unsigned char	*end;
+
+	v = _mm_set1_epi8((char)c);
+	end = d + n;
+	_mm_storeu_si128((__m128i *)d, v);
+	_mm_storeu_si128((__m128i *)(end - 16), v);
+	d = (unsigned char *)(((uintptr_t)d + 16) & ~(uintptr_t)15);
+	while (d + 64 <= end)
+	{
+		_mm_store_si128((__m128i *)d, v);
+		_mm_store_si128((__m128i *)d + 1, v);
+		_mm_store_si128((__m128i *)d + 2, v);
+		_mm_store_si128((__m128i *)d + 3, v);
+		d += 64;
+	}
+	while (d + 16 <= end)
+	{
+		_mm_store_si128((__m128i *)d, v);
+		d += 16;
+	}
+}
+
+#endif
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_mem_word.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:39:16 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 12:39:16 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd.h"
+
+/*
+ * Portable word-at-a-time kernels for ft_memcpy, ft_memmove and ft_memset.
+ * The destination is brought to word alignment byte by byte, the bulk moves
+ * in 8-byte words (four per iteration), and the remaining tail is finished
+ * byte by byte. Source loads go through t_uword, so a misaligned source is
+ * fine on every target.
+ */
+
+void	ft_memcpy_word(unsigned char *d, const unsigned char *s, size_t n)
+{
+	while (n > 0 && ((uintptr_t)d & (WORD_SIZE - 1)))
+	{
+		*d++ = *s++;
+		n--;
+	}
+	while (n >= 4 * WORD_SIZE)
+	{
+		((t_uword *)d)[0] = ((const t_uword *)s)[0];
+		((t_uword *)d)[1] = ((const t_uword *)s)[1];
+		((t_uword *)d)[2] = ((const t_uword *)s)[2];
+		((t_uword *)d)[3] = ((const t_uword *)s)[3];
+		d += 4 * WORD_SIZE;
+		s += 4 * WORD_SIZE;
+		n -= 4 * WORD_SIZE;
+	}
+	while (n >= WORD_SIZE)
+	{
+		*(t_uword *)d = *(const t_uword *)s;
+		d += WORD_SIZE;
+		s += WORD_SIZE;
+		n -= WORD_SIZE;
+	}
+	while (n-- > 0)
+		*d++ = *s++;
+}
+
+/*
+ * Overlap-safe copies. Each word is loaded before it is stored, and the
+ * copy walks away from the overlap, so no byte is read after it has been
+ * overwritten.
+ */
+static void	move_forward(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	w;
+
+	while (n > 0 && ((uintptr_t)d & (WORD_SIZE - 1)))
+	{
+		*d++ = *s++;
+		n--;
+	}
+	while (n >= WORD_SIZE)
+	{
+		w = *(const t_uword *)s;
+		*(t_uword *)d = w;
+		d += WORD_SIZE;
+		s += WORD_SIZE;
+		n -= WORD_SIZE;
+	}
+	while (n-- > 0)
+		*d++ = *s++;
+}
+
+static void	move_backward(unsigned char *d, const unsigned char *s, size_t n)
+{
+	uint64_t	w;
+
+	d += n;
+	s += n;
+	while (n > 0 && ((uintptr_t)d & (WORD_SIZE - 1)))
+	{
+		*--d = *--s;
+		n--;
+	}
+	while (n >= WORD_SIZE)
+	{
+		d -= WORD_SIZE;
+		s -= WORD_SIZE;
+		w = *(const t_uword *)s;
+		*(t_uword *)d = w;
+		n -= WORD_SIZE;
+	}
+	while (n-- > 0)
+		*--d = *--s;
+}
+
+void	ft_memmove_word(unsigned char *d, const unsigned char *s, size_t n)
+{
+	if (d < s || d >= s + n)
+		move_forward(d, s, n);
+	else
+		move_backward(d, s, n);
+}
+
+void	ft_memset_word(unsigned char *d, unsigned char c, size_t n)
+{
+	uint64_t	pattern;
+
+	pattern = WORD_ONES * c;
+	while (n > 0 && ((uintptr_t)d & (WORD_SIZE - 1)))
+	{
+		*d++ = c;
+		n--;
+	}
+	while (n >= 4 * WORD_SIZE)
+	{
+		((t_uword *)d)[0] = pattern;
+		((t_uword *)d)[1] = pattern;
+		((t_uword *)d)[2] = pattern;
+		((t_uword *)d)[3] = pattern;
+		d += 4 * WORD_SIZE;
+		n -= 4 * WORD_SIZE;
+	}
+	while (n >= WORD_SIZE)
+	{
+		*(t_uword *)d = pattern;
+		d += WORD_SIZE;
+		n -= WORD_SIZE;
+	}
+	while (n-- > 0)
+		*d++ = c;
+}
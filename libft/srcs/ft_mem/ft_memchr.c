@@ -6,11 +6,12 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/27 17:12:52 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 13:44:59 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:11 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 NAME
@@ -19,7 +20,7 @@ NAME
 DESCRIPTION
     The ft_memchr function scans the first `n` bytes of the memory area
     pointed to by `s` for the first occurrence of the byte `c`. The search
-    is performed byte by byte.
+    is performed a word or a vector at a time.
 
 PARAMETERS
     s: Pointer to the memory block to search.
@@ -37,6 +38,8 @@ NOTES
       on raw memory, not null-terminated strings.
     - It is the caller's responsibility to ensure the memory block is valid
       and accessible for at least `n` bytes.
+    - Loads are aligned, so the last one may read past `s + n` but never
+      into another page.
 
 BUGS
     The behavior is undefined if `s` is NULL or if `n` exceeds the actual size
@@ -44,18 +47,6 @@ BUGS
 */
 void	*ft_memchr(const void *s, int c, size_t n)
 {
-	unsigned char	*str;
-	unsigned char	cc;
-	size_t			i;
-
-	str = (unsigned char *) s;
-	cc = (unsigned char) c;
-	i = 0;
-	while (i < n)
-	{
-		if (str[i] == cc)
-			return ((void *) &str[i]);
-		i++;
-	}
-	return (NULL);
+	return (ft_dispatch()->memchr((const unsigned char *) s,
+			(unsigned char) c, n));
 }
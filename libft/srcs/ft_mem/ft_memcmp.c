@@ -6,11 +6,12 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/27 18:07:31 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:05:51 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:11 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 NAME
@@ -37,6 +38,8 @@ NOTES
       on raw memory, not strings.
     - The behavior is undefined if `n` exceeds the actual size of either
       memory block.
+    - Equal prefixes are skipped a word or a vector at a time; only the
+      first differing block is compared byte by byte.
 
 BUGS
     The function assumes both memory areas are valid for at least `n` bytes.
@@ -44,18 +47,6 @@ BUGS
 */
 int	ft_memcmp(const void *s1, const void *s2, size_t n)
 {
-	unsigned char	*str1;
-	unsigned char	*str2;
-	size_t			i;
-
-	str1 = (unsigned char *) s1;
-	str2 = (unsigned char *) s2;
-	i = 0;
-	while (i < n)
-	{
-		if ((unsigned char) str1[i] != (unsigned char) str2[i])
-			return ((unsigned char) str1[i] - (unsigned char) str2[i]);
-		i++;
-	}
-	return (0);
+	return (ft_dispatch()->memcmp((const unsigned char *) s1,
+			(const unsigned char *) s2, n));
 }
@@ -6,11 +6,12 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/26 17:12:28 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:06:04 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:11 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 NAME
@@ -28,21 +29,23 @@ PARAMETERS
 
 RETURN VALUES
     Returns a pointer to the destination memory area (dest).
+
+NOTES
+    - Copies below VEC_MIN_SIZE bytes go through the word-at-a-time kernel;
+      larger ones use the SSE2 or AVX2 kernel picked for the host CPU at
+      startup (see ft_dispatch.c).
+    - Both kernels align the destination and cover the unaligned head and
+      tail separately, so no byte outside [dest, dest + n) is touched.
 */
 
 void	*ft_memcpy(void *dest, const void *src, size_t n)
 {
-	unsigned char	*temp_dest;
-	unsigned char	*temp_src;
-
 	if (dest == (void *)0 && src == (void *)0)
 		return (dest);
-	temp_dest = (unsigned char *) dest;
-	temp_src = (unsigned char *) src;
-	while (n > 0)
-	{
-		*(temp_dest++) = *(temp_src++);
-		n--;
-	}
+	if (n < VEC_MIN_SIZE)
+		ft_memcpy_word((unsigned char *)dest, (const unsigned char *)src, n);
+	else
+		ft_dispatch()->memcpy((unsigned char *)dest,
+			(const unsigned char *)src, n);
 	return (dest);
 }
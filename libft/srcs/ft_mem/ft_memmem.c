@@ -0,0 +1,213 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_memmem.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:09:21 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:09:21 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_memmem -- locate a byte string inside another byte string
+
+DESCRIPTION
+    The ft_memmem function finds the first occurrence of the `little_len`
+    bytes at `little` inside the `big_len` bytes at `big`. Neither buffer
+    has to be NUL-terminated and both may contain NUL bytes, so it works on
+    binary message buffers.
+
+PARAMETERS
+    big: The buffer to search.
+    big_len: Number of bytes in `big`.
+    little: The bytes to search for.
+    little_len: Number of bytes in `little`.
+
+RETURN VALUES
+    - Returns a pointer to the first occurrence of `little` in `big`.
+    - If `little_len` is 0, `big` is returned.
+    - If there is no occurrence, the function returns NULL.
+
+NOTES
+    - Single bytes are found with ft_memchr. Longer needles use the Two-Way
+      algorithm (Crochemore and Perrin), which runs in linear time with
+      constant extra space, so no input hits a quadratic worst case.
+    - Each alignment first checks the haystack byte under the last needle
+      byte; when that byte is not in the needle, or sits too far left in
+      it, the whole window is skipped as in Horspool's algorithm. Typical
+      text is therefore searched in sublinear time.
+*/
+
+typedef struct s_twoway
+{
+	const unsigned char	*n;
+	size_t				len;
+	size_t				ms;
+	size_t				period;
+	size_t				mem0;
+	size_t				shift[256];
+	unsigned char		present[256];
+}	t_twoway;
+
+/*
+ * Maximal suffix of the needle for the byte order given by `reverse`.
+ * Returns its start minus one (as size_t, so "before 0" is SIZE_MAX) and
+ * stores the period of that suffix.
+ */
+static size_t	max_suffix(const unsigned char *n, size_t len, int reverse,
+		size_t *period)
+{
+	size_t	ip;
+	size_t	jp;
+	size_t	k;
+
+	ip = (size_t)-1;
+	jp = 0;
+	k = 1;
+	*period = 1;
+	while (jp + k < len)
+	{
+		if (n[ip + k] == n[jp + k] && k == *period)
+		{
+			jp += *period;
+			k = 1;
+		}
+		else if (n[ip + k] == n[jp + k])
+			k++;
+		else if ((n[ip + k] > n[jp + k]) != reverse)
+		{
+			jp += k;
+			k = 1;
+			*period = jp - ip;
+		}
+		else
+		{
+			ip = jp++;
+			k = 1;
+			*period = 1;
+		}
+	}
+	return (ip);
+}
+
+/*
+ * Critical factorisation: the later of the two maximal suffixes splits
+ * the needle at ms + 1. A needle that repeats with that period lets the
+ * search remember the matched prefix (mem0) instead of rescanning it.
+ */
+static void	prepare(t_twoway *tw, const unsigned char *n, size_t len)
+{
+	size_t	ms;
+	size_t	p;
+	size_t	i;
+
+	tw->n = n;
+	tw->len = len;
+	ft_bzero(tw->present, sizeof(tw->present));
+	i = 0;
+	while (i < len)
+	{
+		tw->present[n[i]] = 1;
+		tw->shift[n[i]] = i + 1;
+		i++;
+	}
+	tw->ms = max_suffix(n, len, 0, &tw->period);
+	ms = max_suffix(n, len, 1, &p);
+	if (ms + 1 > tw->ms + 1)
+	{
+		tw->ms = ms;
+		tw->period = p;
+	}
+	tw->mem0 = len - tw->period;
+	if (ft_memcmp(n, n + tw->period, tw->ms + 1) != 0)
+	{
+		tw->mem0 = 0;
+		tw->period = len - tw->ms - 1;
+		if (tw->ms > tw->period)
+			tw->period = tw->ms;
+		tw->period++;
+	}
+}
+
+/*
+ * Distance to move the window at h, or 0 when it must be compared. Uses
+ * the last byte of the window like Horspool's bad-character rule.
+ */
+static size_t	skip(const t_twoway *tw, const unsigned char *h, size_t mem)
+{
+	unsigned char	last;
+	size_t			k;
+
+	last = h[tw->len - 1];
+	if (!tw->present[last])
+		return (tw->len);
+	k = tw->len - tw->shift[last];
+	if (k != 0 && k < mem)
+		k = mem;
+	return (k);
+}
+
+/*
+ * Compares the window at h: right half first, then the left half down to
+ * what a periodic needle already matched. Returns 0 on a match, otherwise
+ * the shift, and updates the remembered prefix length.
+ */
+static size_t	compare(const t_twoway *tw, const unsigned char *h,
+		size_t *mem)
+{
+	size_t	k;
+
+	k = tw->ms + 1;
+	if (*mem > k)
+		k = *mem;
+	while (k < tw->len && tw->n[k] == h[k])
+		k++;
+	if (k < tw->len)
+	{
+		*mem = 0;
+		return (k - tw->ms);
+	}
+	k = tw->ms + 1;
+	while (k > *mem && tw->n[k - 1] == h[k - 1])
+		k--;
+	if (k <= *mem)
+		return (0);
+	*mem = tw->mem0;
+	return (tw->period);
+}
+
+void	*ft_memmem(const void *big, size_t big_len, const void *little,
+		size_t little_len)
+{
+	t_twoway			tw;
+	const unsigned char	*h;
+	size_t				mem;
+	size_t				k;
+
+	if (little_len == 0)
+		return ((void *)big);
+	if (little_len > big_len)
+		return (NULL);
+	if (little_len == 1)
+		return (ft_memchr(big, *(const unsigned char *)little, big_len));
+	prepare(&tw, (const unsigned char *)little, little_len);
+	h = (const unsigned char *)big;
+	mem = 0;
+	while ((size_t)((const unsigned char *)big + big_len - h) >= little_len)
+	{
+		k = skip(&tw, h, mem);
+		if (k != 0)
+			mem = 0;
+		else
+			k = compare(&tw, h, &mem);
+		if (k == 0)
+			return ((void *)h);
+		h += k;
+	}
+	return (NULL);
+}
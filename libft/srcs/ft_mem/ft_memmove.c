@@ -6,11 +6,12 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/26 17:19:31 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:06:13 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:11 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 NAME
@@ -31,37 +32,22 @@ PARAMETERS
 
 RETURN VALUES
     Returns a pointer to the destination memory area (dest).
-*/
-static void	move_backward(char *dest, const char *src, size_t n)
-{
-	while (n > 0)
-	{
-		n--;
-		dest[n] = src[n];
-	}
-}
-
-static void	move_forward(char *dest, const char *src, size_t n)
-{
-	size_t	i;
-
-	i = 0;
-	while (i < n)
-	{
-		dest[i] = src[i];
-		i++;
-	}
-}
 
+NOTES
+    - The kernels copy upwards unless dest starts inside src, in which case
+      they copy downwards; every block is loaded before it can be clobbered.
+    - Moves below VEC_MIN_SIZE bytes use the word-at-a-time kernel.
+*/
 void	*ft_memmove(void *dest, const void *src, size_t n)
 {
 	if (!dest && !src)
 		return (NULL);
 	if (dest == src || n == 0)
 		return (dest);
-	if ((char *)dest > (char *)src)
-		move_backward((char *)dest, (const char *)src, n);
+	if (n < VEC_MIN_SIZE)
+		ft_memmove_word((unsigned char *)dest, (const unsigned char *)src, n);
 	else
-		move_forward((char *)dest, (const char *)src, n);
+		ft_dispatch()->memmove((unsigned char *)dest,
+			(const unsigned char *)src, n);
 	return (dest);
 }
@@ -6,11 +6,12 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/08 18:44:29 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:06:23 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:11 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 NAME
@@ -28,16 +29,16 @@ PARAMETER
 
 RETURN VALUES
     Returns the original pointer s to the memory area.
+
+NOTES
+    - The byte is broadcast to a word or vector and stored with aligned
+      stores; the unaligned head and tail are covered by overlapping stores.
 	*/
 void	*ft_memset(void *s, int c, size_t n)
 {
-	unsigned char	*ptr;
-
-	ptr = (unsigned char *) s;
-	while (n > 0)
-	{
-		*(ptr++) = (unsigned char) c;
-		n--;
-	}
+	if (n < VEC_MIN_SIZE)
+		ft_memset_word((unsigned char *)s, (unsigned char)c, n);
+	else
+		ft_dispatch()->memset((unsigned char *)s, (unsigned char)c, n);
 	return (s);
 }
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_pf_buffer.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:35:17 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:13:10 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/ft_printf.h"
+#include "../../includes/libft.h"
+
+/**
+ * @brief Writes out the buffered bytes with ft_write_all(), which resumes
+ * partial and interrupted writes. Nothing to do in ft_snprintf mode, where
+ * bytes go straight to buf->dst. After a write error, output is discarded.
+ * @return 0 on success, -1 on a write error.
+ */
+int	ft_pf_flush(t_pfbuf *buf)
+{
+	if (!buf->error && buf->fd >= 0 && buf->len > 0
+		&& ft_write_all(buf->fd, buf->data, buf->len) == -1)
+		buf->error = 1;
+	buf->len = 0;
+	if (buf->error)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Appends `n` bytes to the output.
+ * In fd mode the bytes are staged in buf->data; a run larger than the whole
+ * buffer is written through directly after flushing. In ft_snprintf mode
+ * they are copied into buf->dst as far as it has room. buf->total counts
+ * every byte, whether it fit or not.
+ */
+void	ft_pf_putbytes(t_pfbuf *buf, const char *s, size_t n)
+{
+	size_t	room;
+
+	if (buf->fd < 0)
+	{
+		room = 0;
+		if (buf->dst_size > buf->total + 1)
+			room = buf->dst_size - buf->total - 1;
+		if (room > n)
+			room = n;
+		ft_memcpy(buf->dst + buf->total, s, room);
+		buf->total += n;
+		return ;
+	}
+	buf->total += n;
+	if (buf->len + n > PF_BUFFER_SIZE)
+		ft_pf_flush(buf);
+	if (n > PF_BUFFER_SIZE)
+	{
+		if (!buf->error && ft_write_all(buf->fd, s, n) == -1)
+			buf->error = 1;
+		return ;
+	}
+	ft_memcpy(buf->data + buf->len, s, n);
+	buf->len += n;
+}
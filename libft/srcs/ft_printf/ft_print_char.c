@@ -6,18 +6,14 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/02/19 16:08:31 by fyudris           #+#    #+#             */
-/*   Updated: 2025/05/20 22:21:00 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 12:36:19 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../includes/ft_printf.h"
 
-int	ft_print_char(char c)
+int	ft_print_char(t_pfbuf *buf, char c)
 {
-	ssize_t	res;
-
-	res = write(1, &c, 1);
-	if (res < 0)
-		return (-1);
-	return ((int) res);
+	ft_pf_putbytes(buf, &c, 1);
+	return (1);
 }
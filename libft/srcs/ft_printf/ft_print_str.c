@@ -6,22 +6,19 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/02/19 16:14:03 by fyudris           #+#    #+#             */
-/*   Updated: 2025/05/20 22:21:11 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 12:36:19 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../includes/ft_printf.h"
 
-int	ft_print_str(const char *str)
+int	ft_print_str(t_pfbuf *buf, const char *str)
 {
-	int		len;
-	ssize_t	res;
+	size_t	len;
 
 	if (!str)
 		str = "(null)";
 	len = ft_strlen(str);
-	res = (write(1, str, len));
-	if (res < 0)
-		return (-1);
-	return ((int) res);
+	ft_pf_putbytes(buf, str, len);
+	return ((int) len);
 }
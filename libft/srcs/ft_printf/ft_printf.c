@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/11 23:03:34 by fyudris           #+#    #+#             */
-/*   Updated: 2025/05/20 22:21:16 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 12:36:19 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,61 +15,106 @@
 /**
  * @brief Directing specifier to the correct print handler
  *
- * @param
- * @return
+ * @param buf Output buffer of the current call
+ * @param specifier Conversion character following '%'
+ * @param args Pointer to the caller's argument list
+ * @return Number of characters produced, or -1 for an unknown specifier
  */
-int	ft_handle_format(char specifier, va_list args)
+int	ft_handle_format(t_pfbuf *buf, char specifier, va_list *args)
 {
 	if (specifier == '%')
-		return (ft_print_char('%'));
+		return (ft_print_char(buf, '%'));
 	else if (specifier == 'c')
-		return (ft_print_char((char)va_arg(args, int)));
+		return (ft_print_char(buf, (char)va_arg(*args, int)));
 	else if (specifier == 's')
-		return (ft_print_str(va_arg(args, char *)));
+		return (ft_print_str(buf, va_arg(*args, char *)));
 	else if (specifier == 'p')
-		return (ft_print_pointer(va_arg(args, void *)));
+		return (ft_print_pointer(buf, va_arg(*args, void *)));
 	else if (specifier == 'd' || specifier == 'i')
-		return (ft_print_int(va_arg(args, int)));
+		return (ft_print_int(buf, va_arg(*args, int)));
 	else if (specifier == 'u')
-		return (ft_print_unsigned_int(va_arg(args, unsigned int)));
+		return (ft_print_unsigned_int(buf, va_arg(*args, unsigned int)));
 	else if (specifier == 'x')
-		return (ft_print_hex(va_arg(args, unsigned int), HEX_LOWER));
+		return (ft_print_hex(buf, va_arg(*args, unsigned int), HEX_LOWER));
 	else if (specifier == 'X')
-		return (ft_print_hex(va_arg(args, unsigned int), HEX_UPPER));
+		return (ft_print_hex(buf, va_arg(*args, unsigned int), HEX_UPPER));
 	else
 		return (-1);
 }
 
 /**
- * @brief
+ * @brief Formats `format` into `buf`. Literal text between conversions is
+ * appended in whole runs rather than character by character.
  * %[parameter][flags][width][.precision][length]type
- * @param
- * @return
+ * @return 0 on success, -1 on an invalid conversion.
  */
-int	ft_printf(const char *format, ...)
+int	ft_pf_format(t_pfbuf *buf, const char *format, va_list *args)
 {
-	va_list	args;
-	int		count;
-	int		ret;
+	size_t	run;
 
-	if (!format)
-		return (0);
-	va_start(args, format);
-	count = 0;
 	while (*format != '\0')
 	{
+		run = 0;
+		while (format[run] != '\0' && format[run] != '%')
+			run++;
+		ft_pf_putbytes(buf, format, run);
+		format += run;
 		if (*format == '%')
-			ret = ft_handle_format(*(++format), args);
-		else
-			ret = ft_print_char(*(format));
-		if (ret == -1)
 		{
-			va_end(args);
-			return (-1);
+			if (ft_handle_format(buf, format[1], args) == -1)
+				return (-1);
+			format += 2;
 		}
-		count += ret;
-		format++;
 	}
+	return (0);
+}
+
+/**
+ * @brief Core of ft_printf/ft_dprintf: formats into a stack buffer and
+ * issues a single write() for output that fits in PF_BUFFER_SIZE.
+ * Uses no heap or static state, so it is safe to call from a signal handler.
+ * @return Number of characters written, or -1 on error.
+ */
+int	ft_vdprintf(int fd, const char *format, va_list args)
+{
+	t_pfbuf	buf;
+	va_list	ap;
+	int		status;
+
+	if (!format)
+		return (0);
+	buf.len = 0;
+	buf.fd = fd;
+	buf.dst = NULL;
+	buf.dst_size = 0;
+	buf.total = 0;
+	buf.error = 0;
+	va_copy(ap, args);
+	status = ft_pf_format(&buf, format, &ap);
+	va_end(ap);
+	if (ft_pf_flush(&buf) == -1 || status == -1)
+		return (-1);
+	return ((int) buf.total);
+}
+
+int	ft_dprintf(int fd, const char *format, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, format);
+	count = ft_vdprintf(fd, format, args);
+	va_end(args);
+	return (count);
+}
+
+int	ft_printf(const char *format, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, format);
+	count = ft_vdprintf(1, format, args);
 	va_end(args);
 	return (count);
 }
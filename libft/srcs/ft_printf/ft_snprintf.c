@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_snprintf.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:35:58 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 12:36:19 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/ft_printf.h"
+
+/**
+ * @brief Formats into `str`, writing at most `size - 1` characters and
+ * always NUL-terminating when `size` is not 0.
+ * @return The length the full output would have had (like vsnprintf), or
+ * -1 on an invalid conversion.
+ */
+int	ft_vsnprintf(char *str, size_t size, const char *format, va_list args)
+{
+	t_pfbuf	buf;
+	va_list	ap;
+	int		status;
+
+	buf.len = 0;
+	buf.fd = -1;
+	buf.dst = str;
+	buf.dst_size = size;
+	buf.total = 0;
+	buf.error = 0;
+	status = 0;
+	if (format)
+	{
+		va_copy(ap, args);
+		status = ft_pf_format(&buf, format, &ap);
+		va_end(ap);
+	}
+	if (size > 0 && buf.total < size)
+		str[buf.total] = '\0';
+	else if (size > 0)
+		str[size - 1] = '\0';
+	if (status == -1)
+		return (-1);
+	return ((int) buf.total);
+}
+
+int	ft_snprintf(char *str, size_t size, const char *format, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, format);
+	count = ft_vsnprintf(str, size, format, args);
+	va_end(args);
+	return (count);
+}
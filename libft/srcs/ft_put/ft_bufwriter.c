@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_bufwriter.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:37:01 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 12:37:01 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_bufwriter -- buffered output to a file descriptor
+
+DESCRIPTION
+    A t_bufwriter collects small pieces of output (bytes, strings, numbers)
+    in a fixed FT_BW_CAPACITY buffer and hands them to the kernel together.
+    The buffer is flushed once it holds at least `threshold` bytes, when an
+    append would overflow it, and on ft_bw_flush. Runs larger than the whole
+    buffer are written straight through after the pending bytes.
+
+    The writer lives wherever the caller puts it (typically the stack) and
+    owns no heap memory, so it can be used from a signal handler.
+
+RETURN VALUES
+    The ft_bw_* functions return 0 on success and -1 once a write has
+    failed; after a failure the writer discards further output.
+*/
+void	ft_bw_init(t_bufwriter *bw, int fd, size_t threshold)
+{
+	bw->fd = fd;
+	bw->len = 0;
+	bw->error = 0;
+	if (threshold == 0 || threshold > FT_BW_CAPACITY)
+		threshold = FT_BW_CAPACITY;
+	bw->threshold = threshold;
+}
+
+int	ft_bw_flush(t_bufwriter *bw)
+{
+	if (!bw->error && bw->len > 0
+		&& ft_write_all(bw->fd, bw->data, bw->len) == -1)
+		bw->error = 1;
+	bw->len = 0;
+	if (bw->error)
+		return (-1);
+	return (0);
+}
+
+int	ft_bw_putbytes(t_bufwriter *bw, const void *s, size_t n)
+{
+	if (bw->error)
+		return (-1);
+	if (bw->len + n > FT_BW_CAPACITY)
+		ft_bw_flush(bw);
+	if (n > FT_BW_CAPACITY)
+	{
+		if (!bw->error && ft_write_all(bw->fd, s, n) == -1)
+			bw->error = 1;
+		if (bw->error)
+			return (-1);
+		return (0);
+	}
+	ft_memcpy(bw->data + bw->len, s, n);
+	bw->len += n;
+	if (bw->len >= bw->threshold)
+		return (ft_bw_flush(bw));
+	return (0);
+}
+
+int	ft_bw_putstr(t_bufwriter *bw, const char *s)
+{
+	if (!s)
+		s = "(null)";
+	return (ft_bw_putbytes(bw, s, ft_strlen(s)));
+}
+
+int	ft_bw_putchar(t_bufwriter *bw, char c)
+{
+	return (ft_bw_putbytes(bw, &c, 1));
+}
@@ -0,0 +1,35 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_bufwriter_nbr.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:37:01 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:29:38 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_bw_putnbr, ft_bw_putunbr -- append an integer to a t_bufwriter
+
+DESCRIPTION
+    Format `n` in base 10 with ft_fmt_i64/ft_fmt_u64 into a small local
+    buffer and append the digits with a single ft_bw_putbytes call.
+*/
+int	ft_bw_putunbr(t_bufwriter *bw, unsigned long n)
+{
+	char	digits[FT_FMT_BUFSIZE];
+
+	return (ft_bw_putbytes(bw, digits, ft_fmt_u64(digits, n)));
+}
+
+int	ft_bw_putnbr(t_bufwriter *bw, long n)
+{
+	char	digits[FT_FMT_BUFSIZE];
+
+	return (ft_bw_putbytes(bw, digits, ft_fmt_i64(digits, n)));
+}
@@ -6,10 +6,11 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/27 23:11:20 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:21:38 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 15:14:05 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include <sys/uio.h>
 #include "libft.h"
 
 /*
@@ -29,8 +30,10 @@ RETURN VALUES
     None.
 
 NOTES
-    - The function relies on `ft_putstr_fd` to write the string and
-      `ft_putchar_fd` to write the newline character.
+    - The string and the newline are gathered into a single writev(2), so
+      a line usually costs one syscall. A partial write is completed with
+      ft_write_all. This does not make the line atomic; see ft_write_all
+      for when other writers can interleave.
     - Common file descriptors:
         - 0: Standard input
         - 1: Standard output
@@ -38,8 +41,22 @@ NOTES
 */
 void	ft_putendl_fd(char *s, int fd)
 {
+	struct iovec	iov[2];
+	size_t			len;
+	ssize_t			res;
+
 	if (!s)
 		return ;
-	ft_putstr_fd(s, fd);
-	ft_putchar_fd('\n', fd);
+	len = ft_strlen(s);
+	iov[0].iov_base = s;
+	iov[0].iov_len = len;
+	iov[1].iov_base = "\n";
+	iov[1].iov_len = 1;
+	res = writev(fd, iov, 2);
+	if (res < 0)
+		res = 0;
+	if ((size_t) res < len)
+		ft_write_all(fd, s + res, len - res);
+	if ((size_t) res <= len)
+		ft_write_all(fd, "\n", 1);
 }
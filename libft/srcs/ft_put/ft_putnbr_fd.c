@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/27 23:18:07 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:15:56 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:29:38 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,14 +14,15 @@
 
 /*
 NAME
-    ft_putchar_fd -- write a character to a file descriptor
+    ft_putnbr_fd -- write an integer to a file descriptor
 
 DESCRIPTION
-    The ft_putchar_fd function writes the character `c` to the file descriptor
-    `fd`.
+    The ft_putnbr_fd function writes the decimal representation of `n` to
+    the file descriptor `fd`. The digits are formatted with ft_fmt_i64 and
+    written with a single `write` call.
 
 PARAMETERS
-    c: The character to output.
+    n: The integer to output.
     fd: The file descriptor to write to.
 
 RETURN VALUES
@@ -30,28 +31,11 @@ RETURN VALUES
 NOTES
     - If `fd` is invalid or there is an error during the `write` operation,
       the behavior is undefined.
-    - Common `fd` values:
-        - 0: Standard input
-        - 1: Standard output
-        - 2: Standard error
 */
 
 void	ft_putnbr_fd(int n, int fd)
 {
-	char	digit;
-
-	if (n == -2147483648)
-	{
-		write(fd, "-2147483648", 11);
-		return ;
-	}
-	if (n < 0)
-	{
-		ft_putchar_fd('-', fd);
-		n = -n;
-	}
-	if (n > 9)
-		ft_putnbr_fd(n / 10, fd);
-	digit = n % 10 + '0';
-	ft_putchar_fd(digit, fd);
+	char	digits[FT_FMT_BUFSIZE];
+
+	ft_write_all(fd, digits, ft_fmt_i64(digits, n));
 }
@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/27 23:07:20 by fyudris           #+#    #+#             */
-/*   Updated: 2025/06/04 15:37:41 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 15:14:05 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,10 +25,13 @@ PARAMETERS
     fd: The file descriptor to write to.
 
 RETURN VALUES
-    None.
+    The number of bytes written, or -1 if `s` is NULL or the write failed.
 
 NOTES
-    - The function relies on `ft_putchar_fd` to write individual characters.
+    - The length is computed once and the string is written in as few
+      syscalls as possible: one write(2), plus one more for the remainder
+      whenever the kernel takes only part of it. This does not make the
+      write atomic; see ft_write_all for when other writers can interleave.
     - Common file descriptors:
         - 0: Standard input
         - 1: Standard output
@@ -36,15 +39,7 @@ NOTES
 */
 int	ft_putstr_fd(char *s, int fd)
 {
-	int	count;
-
-	count = 0;
 	if (!s)
 		return (-1);
-	while (*s)
-	{
-		count += ft_putchar_fd(*s, fd);
-		s++;
-	}
-	return (count);
+	return ((int) ft_write_all(fd, s, ft_strlen(s)));
 }
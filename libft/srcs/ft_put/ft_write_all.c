@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_write_all.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:36:45 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:14:05 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include "libft.h"
+
+/*
+NAME
+    ft_write_all -- write a whole buffer to a file descriptor
+
+DESCRIPTION
+    The ft_write_all function writes the `n` bytes at `buf` to `fd`,
+    issuing another write(2) for the remainder whenever the kernel accepts
+    only part of the buffer or the call is interrupted by a signal.
+
+PARAMETERS
+    fd: The file descriptor to write to.
+    buf: The bytes to write.
+    n: The number of bytes to write.
+
+RETURN VALUES
+    The number of bytes written (`n`), or -1 if write(2) failed.
+
+NOTES
+    - Only a write(2) of at most PIPE_BUF bytes to a pipe or FIFO is
+      guaranteed not to be interleaved with other writers. Larger writes,
+      writes to a terminal, and a buffer split by a partial write can all
+      be interleaved.
+*/
+ssize_t	ft_write_all(int fd, const void *buf, size_t n)
+{
+	const char	*bytes;
+	size_t		done;
+	ssize_t		res;
+
+	bytes = (const char *) buf;
+	done = 0;
+	while (done < n)
+	{
+		res = write(fd, bytes + done, n - done);
+		if (res == -1 && errno == EINTR)
+			continue ;
+		if (res <= 0)
+			return (-1);
+		done += res;
+	}
+	return ((ssize_t) done);
+}
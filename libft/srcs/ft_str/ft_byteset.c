@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_byteset.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:11:52 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:11:52 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "ft_simd.h"
+
+/*
+NAME
+    ft_byteset_init, ft_byteset_add, ft_byteset_has -- 256-bit byte sets
+
+DESCRIPTION
+    A t_byteset holds any subset of the 256 byte values. ft_byteset_init
+    empties the set and adds every byte of the string `chars`;
+    ft_byteset_add adds one byte, which may be '\0'. ft_byteset_has tests
+    membership with one shift and mask, without branches.
+
+    Build a set once and reuse it: membership costs O(1) whatever the size
+    of the set, where ft_strchr(set, c) costs O(|set|) per byte tested. The
+    span functions (see ft_byteset_span.c) classify whole buffers at once.
+
+PARAMETERS
+    set: The byte set.
+    chars: Null-terminated string of bytes to add; NULL gives an empty set.
+    c: A byte value.
+
+RETURN VALUES
+    ft_byteset_has returns 1 if `c` is in the set, 0 otherwise.
+
+NOTES
+    - Besides the bitmap the set keeps two 16-byte tables indexed by low
+      nibble, holding one bit per high nibble (0-7 and 8-15). SIMD kernels
+      look them up with pshufb to classify 16 or 32 bytes per instruction.
+*/
+void	ft_byteset_init(t_byteset *set, const char *chars)
+{
+	ft_bzero(set, sizeof(*set));
+	while (chars && *chars)
+		ft_byteset_add(set, (unsigned char)*chars++);
+}
+
+void	ft_byteset_add(t_byteset *set, unsigned char c)
+{
+	set->bits[c >> 6] |= (uint64_t)1 << (c & 63);
+	if (c >> 4 < 8)
+		set->nibble_lo[c & 15] |= 1 << (c >> 4);
+	else
+		set->nibble_hi[c & 15] |= 1 << ((c >> 4) - 8);
+}
+
+int	ft_byteset_has(const t_byteset *set, unsigned char c)
+{
+	return ((set->bits[c >> 6] >> (c & 63)) & 1);
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_byteset_simd.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:11:52 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:11:52 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd.h"
+
+/*
+ * SIMD kernels for ft_byteset_span/cspan. Each byte b is classified with
+ * two pshufb lookups: the low nibble selects a row of the set's nibble
+ * tables, the high nibble selects the bit within the row. The SSE kernel
+ * needs pshufb (SSSE3) and pblendvb (SSE4.1), so it is dispatched at the
+ * SSE4.2 level; the AVX2 one uses the same tables in both 128-bit lanes.
+ * Bytes are read with unaligned loads that stay inside [s, s + n).
+ */
+#if FT_X86_SIMD
+
+FT_SSE42
+static inline unsigned int	members_sse42(const t_byteset *set, __m128i v)
+{
+	__m128i	nibble;
+	__m128i	lo;
+	__m128i	hi;
+	__m128i	row;
+	__m128i	bit;
+
+	nibble = _mm_set1_epi8(0x0F);
+	lo = _mm_and_si128(v, nibble);
+	hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+	row = _mm_blendv_epi8(
+			_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)set->nibble_lo),
+				lo),
+			_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)set->nibble_hi),
+				lo),
+			_mm_cmpgt_epi8(hi, _mm_set1_epi8(7)));
+	bit = _mm_shuffle_epi8(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+				1, 2, 4, 8, 16, 32, 64, -128), hi);
+	return ((unsigned int)_mm_movemask_epi8(
+			_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit)));
+}
+
+FT_SSE42
+size_t	ft_byteset_span_sse42(const t_byteset *set, const unsigned char *s,
+		size_t n, int in_set)
+{
+	unsigned int	flip;
+	unsigned int	match;
+	size_t			i;
+
+	flip = 0xFFFF;
+	if (in_set)
+		flip = 0;
+	i = 0;
+	while (i + 16 <= n)
+	{
+		match = members_sse42(set,
+				_mm_loadu_si128((const __m128i *)(s + i))) ^ flip;
+		if (match != 0xFFFF)
+			return (i + __builtin_ctz(~match));
+		i += 16;
+	}
+	return (i + ft_byteset_span_word(set, s + i, n - i, in_set));
+}
+
+FT_AVX2
+static inline unsigned int	members_avx2(const t_byteset *set, __m256i v)
+{
+	__m256i	nibble;
+	__m256i	lo;
+	__m256i	hi;
+	__m256i	row;
+	__m256i	bit;
+
+	nibble = _mm256_set1_epi8(0x0F);
+	lo = _mm256_and_si256(v, nibble);
+	hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+	row = _mm256_blendv_epi8(
+			_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+					_mm_loadu_si128((const __m128i *)set->nibble_lo)), lo),
+			_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+					_mm_loadu_si128((const __m128i *)set->nibble_hi)), lo),
+			_mm256_cmpgt_epi8(hi, _mm256_set1_epi8(7)));
+	bit = _mm256_shuffle_epi8(_mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+				1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+				1, 2, 4, 8, 16, 32, 64, -128), hi);
+	return ((unsigned int)_mm256_movemask_epi8(
+			_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit)));
+}
+
+FT_AVX2
+size_t	ft_byteset_span_avx2(const t_byteset *set, const unsigned char *s,
+		size_t n, int in_set)
+{
+	unsigned int	flip;
+	unsigned int	match;
+	size_t			i;
+
+	flip = 0xFFFFFFFF;
+	if (in_set)
+		flip = 0;
+	i = 0;
+	while (i + 32 <= n)
+	{
+		match = members_avx2(set,
+				_mm256_loadu_si256((const __m256i *)(s + i))) ^ flip;
+		if (match != 0xFFFFFFFF)
+			return (i + __builtin_ctz(~match));
+		i += 32;
+	}
+	return (i + ft_byteset_span_word(set, s + i, n - i, in_set));
+}
+
+#endif
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_byteset_span.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:11:52 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:11:52 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "ft_simd.h"
+
+/*
+NAME
+    ft_byteset_span, ft_byteset_cspan, ft_byteset_rspan -- classify a buffer
+
+DESCRIPTION
+    ft_byteset_span returns the length of the longest prefix of the `n`
+    bytes at `s` made only of bytes in `set`; ft_byteset_cspan the longest
+    prefix made only of bytes outside it. ft_byteset_rspan returns the
+    length of the longest suffix made only of bytes in `set`.
+
+    These are the byte-set counterparts of strspn and strcspn, bounded by
+    `n` instead of a terminator, so they also work on binary buffers.
+
+PARAMETERS
+    set: The byte set.
+    s: Pointer to the bytes to classify.
+    n: Number of bytes.
+
+RETURN VALUES
+    The length of the prefix (or suffix), between 0 and `n`.
+
+NOTES
+    - ft_byteset_span and ft_byteset_cspan classify 16 or 32 bytes at a time
+      with pshufb lookups on hosts with SSE4.2 or AVX2, and fall back to the
+      bitmap otherwise (see ft_dispatch.c).
+    - ft_byteset_rspan is scalar: it serves trimming, where the suffix is
+      short.
+*/
+size_t	ft_byteset_span_word(const t_byteset *set, const unsigned char *s,
+		size_t n, int in_set)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n && (int)((set->bits[s[i] >> 6] >> (s[i] & 63)) & 1) == in_set)
+		i++;
+	return (i);
+}
+
+size_t	ft_byteset_span(const t_byteset *set, const void *s, size_t n)
+{
+	return (ft_dispatch()->byteset_span(set, s, n, 1));
+}
+
+size_t	ft_byteset_cspan(const t_byteset *set, const void *s, size_t n)
+{
+	return (ft_dispatch()->byteset_span(set, s, n, 0));
+}
+
+size_t	ft_byteset_rspan(const t_byteset *set, const void *s, size_t n)
+{
+	const unsigned char	*end;
+	size_t				len;
+
+	end = (const unsigned char *)s + n;
+	len = 0;
+	while (len < n && ft_byteset_has(set, *(end - len - 1)))
+		len++;
+	return (len);
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_cmp_avx2.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:00:47 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:00:47 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd.h"
+
+/*
+ * AVX2 kernels for ft_memcmp and ft_strncmp. Both compare 32 bytes per step
+ * with unaligned loads; ft_strncmp only issues a load when it cannot cross
+ * into the next page and compares bytes otherwise.
+ * Built through a target attribute; callers must check CPU support first.
+ */
+#if FT_X86_SIMD
+
+/* One bit per byte where a and b differ, or where a holds a terminator */
+FT_AVX2
+static inline unsigned int	stop_mask(const unsigned char *a,
+		const unsigned char *b, int strings)
+{
+	__m256i			va;
+	unsigned int	mask;
+
+	va = _mm256_loadu_si256((const __m256i *)a);
+	mask = 0xFFFFFFFF ^ (unsigned int)_mm256_movemask_epi8(
+			_mm256_cmpeq_epi8(va, _mm256_loadu_si256((const __m256i *)b)));
+	if (strings)
+		mask |= (unsigned int)_mm256_movemask_epi8(
+				_mm256_cmpeq_epi8(va, _mm256_setzero_si256()));
+	return (mask);
+}
+
+FT_AVX2
+int	ft_memcmp_avx2(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	unsigned int	mask;
+
+	while (n >= 32)
+	{
+		mask = stop_mask(a, b, 0);
+		if (mask)
+			return (a[__builtin_ctz(mask)] - b[__builtin_ctz(mask)]);
+		a += 32;
+		b += 32;
+		n -= 32;
+	}
+	return (ft_memcmp_word(a, b, n));
+}
+
+FT_AVX2
+int	ft_strncmp_avx2(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	unsigned int	mask;
+	int				stop;
+	int				result;
+
+	while (n >= 32)
+	{
+		if (ft_page_safe(a, 32) && ft_page_safe(b, 32))
+		{
+			mask = stop_mask(a, b, 1);
+			if (mask)
+				return (a[__builtin_ctz(mask)] - b[__builtin_ctz(mask)]);
+		}
+		else
+		{
+			result = ft_strncmp_bytes(a, b, 32, &stop);
+			if (stop)
+				return (result);
+		}
+		a += 32;
+		b += 32;
+		n -= 32;
+	}
+	return (ft_strncmp_bytes(a, b, n, &stop));
+}
+
+#endif
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_cmp_sse2.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:00:47 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:00:47 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd.h"
+
+/*
+ * SSE2 kernels for ft_memcmp and ft_strncmp. Both compare 16 bytes per step
+ * with unaligned loads; ft_strncmp only issues a load when it cannot cross
+ * into the next page and compares bytes otherwise.
+ */
+#if FT_X86_SIMD
+
+/* One bit per byte where a and b differ, or where a holds a terminator */
+static inline unsigned int	stop_mask(const unsigned char *a,
+		const unsigned char *b, int strings)
+{
+	__m128i			va;
+	unsigned int	mask;
+
+	va = _mm_loadu_si128((const __m128i *)a);
+	mask = 0xFFFF ^ (unsigned int)_mm_movemask_epi8(
+			_mm_cmpeq_epi8(va, _mm_loadu_si128((const __m128i *)b)));
+	if (strings)
+		mask |= (unsigned int)_mm_movemask_epi8(
+				_mm_cmpeq_epi8(va, _mm_setzero_si128()));
+	return (mask);
+}
+
+int	ft_memcmp_sse2(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	unsigned int	mask;
+
+	while (n >= 16)
+	{
+		mask = stop_mask(a, b, 0);
+		if (mask)
+			return (a[__builtin_ctz(mask)] - b[__builtin_ctz(mask)]);
+		a += 16;
+		b += 16;
+		n -= 16;
+	}
+	return (ft_memcmp_word(a, b, n));
+}
+
+int	ft_strncmp_sse2(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	unsigned int	mask;
+	int				stop;
+	int				result;
+
+	while (n >= 16)
+	{
+		if (ft_page_safe(a, 16) && ft_page_safe(b, 16))
+		{
+			mask = stop_mask(a, b, 1);
+			if (mask)
+				return (a[__builtin_ctz(mask)] - b[__builtin_ctz(mask)]);
+		}
+		else
+		{
+			result = ft_strncmp_bytes(a, b, 16, &stop);
+			if (stop)
+				return (result);
+		}
+		a += 16;
+		b += 16;
+		n -= 16;
+	}
+	return (ft_strncmp_bytes(a, b, n, &stop));
+}
+
+#endif
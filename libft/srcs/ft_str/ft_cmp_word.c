@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_cmp_word.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:00:14 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:00:14 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd.h"
+
+/*
+ * Word-at-a-time kernels for ft_memcmp and ft_strncmp. Words are compared
+ * whole and the first differing word is resolved byte by byte. The two
+ * pointers rarely share an alignment, so ft_strncmp uses unaligned loads and
+ * falls back to bytes whenever a load could run into the next page.
+ */
+
+int	ft_memcmp_word(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	while (n >= WORD_SIZE && *(const t_uword *)a == *(const t_uword *)b)
+	{
+		a += WORD_SIZE;
+		b += WORD_SIZE;
+		n -= WORD_SIZE;
+	}
+	while (n-- > 0)
+	{
+		if (*a != *b)
+			return (*a - *b);
+		a++;
+		b++;
+	}
+	return (0);
+}
+
+/*
+ * Compares at most n bytes and sets *stop when a difference or terminator
+ * ends the comparison; the return value is then the final result.
+ */
+int	ft_strncmp_bytes(const unsigned char *a, const unsigned char *b,
+		size_t n, int *stop)
+{
+	size_t	i;
+
+	i = 0;
+	*stop = 1;
+	while (i < n)
+	{
+		if (a[i] != b[i] || a[i] == '\0')
+			return (a[i] - b[i]);
+		i++;
+	}
+	*stop = 0;
+	return (0);
+}
+
+/* True when the next word of a and b is readable, equal and NUL-free */
+static int	word_matches(const unsigned char *a, const unsigned char *b)
+{
+	uint64_t	w;
+
+	if (!ft_page_safe(a, WORD_SIZE) || !ft_page_safe(b, WORD_SIZE))
+		return (0);
+	w = *(const t_uword *)a;
+	return (w == *(const t_uword *)b && !ft_word_zeros(w));
+}
+
+int	ft_strncmp_word(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	int	stop;
+	int	result;
+
+	while (n >= WORD_SIZE)
+	{
+		if (!word_matches(a, b))
+		{
+			result = ft_strncmp_bytes(a, b, WORD_SIZE, &stop);
+			if (stop)
+				return (result);
+		}
+		a += WORD_SIZE;
+		b += WORD_SIZE;
+		n -= WORD_SIZE;
+	}
+	return (ft_strncmp_bytes(a, b, n, &stop));
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_scan_sse2.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:00:35 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:00:35 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd.h"
+
+/*
+ * SSE2 kernels for ft_strlen, ft_memchr, ft_strchr and ft_strrchr. Loads
+ * start at the 16-byte block holding s and stay aligned, so a load never
+ * crosses a page even when it runs past the terminator or the end of the
+ * buffer. Bytes of the first block that sit before s are masked off.
+ */
+#if FT_X86_SIMD
+
+/* One bit per byte of the aligned block at p that equals its byte in x */
+static inline unsigned int	eq_mask(const void *p, __m128i x)
+{
+	return ((unsigned int)_mm_movemask_epi8(
+			_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p), x)));
+}
+
+size_t	ft_strlen_sse2(const char *s)
+{
+	const char		*p;
+	unsigned int	mask;
+
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)15);
+	mask = eq_mask(p, _mm_setzero_si128()) & (~0u << ((uintptr_t)s & 15));
+	while (mask == 0)
+	{
+		p += 16;
+		mask = eq_mask(p, _mm_setzero_si128());
+	}
+	return (p + __builtin_ctz(mask) - s);
+}
+
+void	*ft_memchr_sse2(const unsigned char *s, unsigned char c, size_t n)
+{
+	const unsigned char	*p;
+	const unsigned char	*end;
+	__m128i				needle;
+	unsigned int		mask;
+
+	if (n == 0)
+		return (NULL);
+	end = s + n;
+	needle = _mm_set1_epi8((char)c);
+	p = (const unsigned char *)((uintptr_t)s & ~(uintptr_t)15);
+	mask = eq_mask(p, needle) & (~0u << ((uintptr_t)s & 15));
+	while (mask == 0 && p + 16 < end)
+	{
+		p += 16;
+		mask = eq_mask(p, needle);
+	}
+	if (mask == 0 || p + __builtin_ctz(mask) >= end)
+		return (NULL);
+	return ((void *)(p + __builtin_ctz(mask)));
+}
+
+char	*ft_strchr_sse2(const char *s, char c)
+{
+	const char		*p;
+	__m128i			needle;
+	__m128i			zero;
+	unsigned int	mask;
+
+	needle = _mm_set1_epi8(c);
+	zero = _mm_setzero_si128();
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)15);
+	mask = (eq_mask(p, needle) | eq_mask(p, zero))
+		& (~0u << ((uintptr_t)s & 15));
+	while (mask == 0)
+	{
+		p += 16;
+		mask = eq_mask(p, needle) | eq_mask(p, zero);
+	}
+	p += __builtin_ctz(mask);
+	if (*p == c)
+		return ((char *)p);
+	return (NULL);
+}
+
+/*
+ * Tracks the block of the last c seen; in the block holding the terminator
+ * only the matches up to the terminator count.
+ */
+char	*ft_strrchr_sse2(const char *s, char c)
+{
+	const char		*p;
+	const char		*last;
+	__m128i			needle;
+	unsigned int	first;
+	unsigned int	zeros;
+	unsigned int	hits;
+
+	if (c == '\0')
+		return ((char *)s + ft_strlen_sse2(s));
+	needle = _mm_set1_epi8(c);
+	last = NULL;
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)15);
+	first = ~0u << ((uintptr_t)s & 15);
+	while ((eq_mask(p, _mm_setzero_si128()) & first) == 0)
+	{
+		hits = eq_mask(p, needle) & first;
+		if (hits)
+			last = p + 31 - __builtin_clz(hits);
+		first = ~0u;
+		p += 16;
+	}
+	zeros = eq_mask(p, _mm_setzero_si128()) & first;
+	hits = eq_mask(p, needle) & first & (zeros ^ (zeros - 1));
+	if (hits)
+		last = p + 31 - __builtin_clz(hits);
+	return ((char *)last);
+}
+
+#endif
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_scan_word.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:00:01 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:00:01 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd.h"
+
+/*
+ * SWAR (SIMD within a register) kernels for ft_strlen, ft_memchr, ft_strchr
+ * and ft_strrchr. Bytes are stepped one at a time until the pointer is word
+ * aligned; from there every load is an aligned 8-byte word, which can never
+ * straddle a page boundary even when it reaches past the terminator.
+ */
+
+size_t	ft_strlen_word(const char *s)
+{
+	const char	*p;
+	uint64_t	zeros;
+
+	p = s;
+	while ((uintptr_t)p & (WORD_SIZE - 1))
+	{
+		if (*p == '\0')
+			return (p - s);
+		p++;
+	}
+	zeros = ft_word_zeros(*(const t_uword *)p);
+	while (zeros == 0)
+	{
+		p += WORD_SIZE;
+		zeros = ft_word_zeros(*(const t_uword *)p);
+	}
+	return (p + ft_word_first(zeros) - s);
+}
+
+void	*ft_memchr_word(const unsigned char *s, unsigned char c, size_t n)
+{
+	uint64_t	pattern;
+	uint64_t	hits;
+
+	while (n > 0 && ((uintptr_t)s & (WORD_SIZE - 1)))
+	{
+		if (*s == c)
+			return ((void *)s);
+		s++;
+		n--;
+	}
+	pattern = WORD_ONES * c;
+	while (n >= WORD_SIZE)
+	{
+		hits = ft_word_zeros(*(const t_uword *)s ^ pattern);
+		if (hits)
+			return ((void *)(s + ft_word_first(hits)));
+		s += WORD_SIZE;
+		n -= WORD_SIZE;
+	}
+	while (n-- > 0)
+	{
+		if (*s == c)
+			return ((void *)s);
+		s++;
+	}
+	return (NULL);
+}
+
+/* Stops on the first byte that is either c or the terminator */
+char	*ft_strchr_word(const char *s, char c)
+{
+	uint64_t	pattern;
+	uint64_t	w;
+	uint64_t	stop;
+
+	while ((uintptr_t)s & (WORD_SIZE - 1))
+	{
+		if (*s == c)
+			return ((char *)s);
+		if (*s == '\0')
+			return (NULL);
+		s++;
+	}
+	pattern = WORD_ONES * (unsigned char)c;
+	w = *(const t_uword *)s;
+	stop = ft_word_zeros(w) | ft_word_zeros(w ^ pattern);
+	while (stop == 0)
+	{
+		s += WORD_SIZE;
+		w = *(const t_uword *)s;
+		stop = ft_word_zeros(w) | ft_word_zeros(w ^ pattern);
+	}
+	s += ft_word_first(stop);
+	if (*s == c)
+		return ((char *)s);
+	return (NULL);
+}
+
+/*
+ * Remembers the last c in every word that holds no terminator; the word
+ * that does is finished byte by byte, as it may hold c on either side of
+ * the terminator.
+ */
+char	*ft_strrchr_word(const char *s, char c)
+{
+	const char	*last;
+	uint64_t	pattern;
+	uint64_t	w;
+
+	if (c == '\0')
+		return ((char *)s + ft_strlen_word(s));
+	last = NULL;
+	while ((uintptr_t)s & (WORD_SIZE - 1))
+	{
+		if (*s == c)
+			last = s;
+		if (*s++ == '\0')
+			return ((char *)last);
+	}
+	pattern = WORD_ONES * (unsigned char)c;
+	w = *(const t_uword *)s;
+	while (!ft_word_zeros(w))
+	{
+		if (ft_word_zeros(w ^ pattern))
+			last = s + ft_word_last(ft_word_zeros(w ^ pattern));
+		s += WORD_SIZE;
+		w = *(const t_uword *)s;
+	}
+	while (*s)
+	{
+		if (*s++ == c)
+			last = s - 1;
+	}
+	return ((char *)last);
+}
@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/27 20:59:13 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 14:34:46 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 14:47:28 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,16 +14,19 @@
 
 /*
 NAME
-    ft_split -- split a string into an array of words
+    ft_split, ft_split_set -- split a string into an array of words
 
 DESCRIPTION
     The ft_split function splits the string `s` into an array of words,
     separated by the character `c`. Words are defined as substrings of
     `s` delimited by `c`.
+    ft_split_set does the same with every byte of the string `set` acting
+    as a delimiter, so "a, b;c" split on ", ;" gives "a", "b" and "c".
 
 PARAMETERS
     s: The input string to split.
     c: The delimiter character.
+    set: The null-terminated set of delimiter characters.
 
 RETURN VALUES
     - Returns a NULL-terminated array of strings, where each string is a word.
@@ -34,31 +37,43 @@ NOTES
       freeing the array and its contents.
     - If the input string is empty or contains only delimiters, the function
       returns an array containing a single NULL pointer.
+    - The words are found with a t_tokenizer, once to count them
+      (ft_tok_count) and once to copy them. Its runs are measured with
+      ft_byteset_span/cspan, 16 or 32 bytes at a time where the CPU allows.
 
 BUGS
     The function assumes `s` is a valid null-terminated string. Passing NULL
     or an invalid pointer results in undefined behavior.
 */
-static size_t	count_words(const char *s, char c);
-static char		*extract_next_word(const char **s, char c);
-static void		free_all(char **words, int count);
+static void	free_all(char **words, int count);
 
 char	**ft_split(const char *s, char c)
 {
-	char	**result;
-	size_t	word_count;
-	int		i;
+	char	set[2];
 
-	if (!s)
+	set[0] = c;
+	set[1] = '\0';
+	return (ft_split_set(s, set));
+}
+
+char	**ft_split_set(const char *s, const char *set)
+{
+	t_tokenizer	tok;
+	char		**result;
+	const char	*word;
+	size_t		word_len;
+	size_t		i;
+
+	if (!s || !set)
 		return (NULL);
-	word_count = count_words(s, c);
-	result = (char **) malloc((word_count + 1) * sizeof(char *));
+	ft_tok_init(&tok, s, ft_strlen(s), set);
+	result = (char **) malloc((ft_tok_count(&tok) + 1) * sizeof(char *));
 	if (!result)
 		return (NULL);
 	i = 0;
-	while (i < (int) word_count)
+	while (ft_tok_next(&tok, &word, &word_len))
 	{
-		result[i] = extract_next_word(&s, c);
+		result[i] = ft_strndup(word, word_len);
 		if (!result[i])
 		{
 			free_all(result, i);
@@ -70,51 +85,6 @@ char	**ft_split(const char *s, char c)
 	return (result);
 }
 
-/*
-* Count the number of words in the input string 's' separated by the
-* delimiter 'c'.
-*/
-static size_t	count_words(const char *s, char c)
-{
-	size_t	count;
-
-	count = 0;
-	while (*s)
-	{
-		while (*s == c)
-			s++;
-		if (*s)
-		{
-			count++;
-			while (*s != c && *s)
-				s++;
-		}
-	}
-	return (count);
-}
-
-/**
- * Extracts the next word from the input string `s` separated
- * by the character `c`.
- * The pointer `s` is updated to point to the character after
- * the extracted word.
- */
-static char	*extract_next_word(const char **s, char c)
-{
-	const char	*start;
-	const char	*end;
-	char		*word;
-
-	while (**s == c)
-		(*s)++;
-	start = *s;
-	while (**s != c && **s)
-		(*s)++;
-	end = *s;
-	word = ft_substr(start, 0, end - start);
-	return (word);
-}
-
 static void	free_all(char **words, int count)
 {
 	while (count)
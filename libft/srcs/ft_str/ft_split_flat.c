@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_split_flat.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:14:23 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:47:28 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_split_flat -- split a string into words held in one allocation
+
+DESCRIPTION
+    The ft_split_flat function splits `s` on runs of bytes from `set`, like
+    ft_split_set, but returns a single block: the NULL-terminated pointer
+    array followed by a copy of `s` in which every word is terminated in
+    place. The whole result is released with one call to free().
+
+PARAMETERS
+    s: The input string to split.
+    set: The null-terminated set of delimiter characters.
+
+RETURN VALUES
+    - Returns a NULL-terminated array of strings, where each string is a word.
+    - Returns NULL if memory allocation fails or if `s` or `set` is NULL.
+
+NOTES
+    - Free the result with free() only. Do not free the individual words
+      or pass the result to ft_free_array.
+    - One pass counts the words (ft_tok_count) and one copies the string
+      and terminates the words; both measure runs with
+      ft_byteset_span/cspan. The cost per
+      word is a few stores instead of a malloc.
+*/
+/* Points words[] into the copy at text and terminates every word */
+static void	fill_words(char **words, char *text, size_t len,
+		const t_byteset *delims)
+{
+	size_t	i;
+
+	i = ft_byteset_span(delims, text, len);
+	while (i < len)
+	{
+		*words++ = text + i;
+		i += ft_byteset_cspan(delims, text + i, len - i);
+		text[i] = '\0';
+		if (i < len)
+			i += 1 + ft_byteset_span(delims, text + i + 1, len - i - 1);
+	}
+	*words = NULL;
+}
+
+char	**ft_split_flat(const char *s, const char *set)
+{
+	t_tokenizer	tok;
+	char		**words;
+	size_t		count;
+	size_t		len;
+
+	if (!s || !set)
+		return (NULL);
+	len = ft_strlen(s);
+	ft_tok_init(&tok, s, len, set);
+	count = ft_tok_count(&tok);
+	words = (char **) malloc((count + 1) * sizeof(char *) + len + 1);
+	if (!words)
+		return (NULL);
+	ft_memcpy(words + count + 1, s, len + 1);
+	fill_words(words, (char *)(words + count + 1), len, &tok.delims);
+	return (words);
+}
@@ -6,11 +6,12 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/26 15:18:52 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 13:30:49 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:11 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 NAME
@@ -33,6 +34,8 @@ NOTES
     - The input character `c` is cast to a char, allowing non-ASCII values to
       be processed, but the behavior for such values is undefined.
     - The function assumes that the input string `s` is null-terminated.
+    - The scan looks for `c` and the terminator together, a word or vector
+      at a time, using aligned loads that never cross a page.
 
 BUGS
     If the input string `s` is NULL, the behavior is undefined. It is the
@@ -40,18 +43,5 @@ BUGS
 */
 char	*ft_strchr(const char *s, int c)
 {
-	unsigned int	i;
-	char			cc;
-
-	cc = (char) c;
-	i = 0;
-	while (s[i])
-	{
-		if (s[i] == cc)
-			return ((char *) &s[i]);
-		i++;
-	}
-	if (s[i] == cc)
-		return ((char *) &s[i]);
-	return (NULL);
+	return (ft_dispatch()->strchr(s, (char) c));
 }
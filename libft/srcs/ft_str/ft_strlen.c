@@ -6,11 +6,12 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/08 18:36:22 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 23:07:30 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:11 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 NAME
@@ -22,13 +23,12 @@ DECRIPTION
 RETURN VALUES
     The ft_strlen() function returns the number of characters that precede 
 	the terminating NUL character.
+
+NOTES
+    The string is scanned a word or a vector at a time with aligned loads,
+    which never cross a page, so reading past the terminator is safe.
 */
 size_t	ft_strlen(const char *s)
 {
-	size_t	len;
-
-	len = 0;
-	while (s[len])
-		len++;
-	return (len);
+	return (ft_dispatch()->strlen(s));
 }
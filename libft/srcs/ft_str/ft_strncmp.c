@@ -6,11 +6,12 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/12 20:07:26 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 13:40:40 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:11 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 NAME
@@ -38,6 +39,9 @@ NOTES
       comparing `n` characters, whichever comes first.
     - The function uses unsigned character values to ensure proper handling
       of extended ASCII and non-ASCII characters.
+    - Blocks of both strings are compared at once with unaligned loads, but
+      only where a load cannot run into the next page; near a page end the
+      comparison drops to single bytes.
 
 BUGS
     The behavior is undefined if `s1` or `s2` is not null-terminated and `n`
@@ -45,14 +49,6 @@ BUGS
 */
 int	ft_strncmp(const char *s1, const char *s2, size_t n)
 {
-	size_t	i;
-
-	i = 0;
-	while (i < n)
-	{
-		if (s1[i] != s2[i] || s1[i] == '\0' || s2[i] == '\0')
-			return ((unsigned char) s1[i] - (unsigned char) s2[i]);
-		i++;
-	}
-	return (0);
+	return (ft_dispatch()->strncmp((const unsigned char *) s1,
+			(const unsigned char *) s2, n));
 }
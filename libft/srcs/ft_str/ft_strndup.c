@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strndup.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:12:41 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:12:41 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_strndup -- duplicate at most n bytes of a string
+
+DESCRIPTION
+    The ft_strndup function allocates a new string holding the first `n`
+    bytes of `s`, or all of `s` if it is shorter, followed by a null
+    terminator.
+
+PARAMETERS
+    s: The string to duplicate; it need not be terminated within `n` bytes.
+    n: The maximum number of bytes to copy.
+
+RETURN VALUES
+    - Returns a pointer to the new string.
+    - If memory allocation fails, the function returns NULL.
+
+NOTES
+    - Only the first `n` bytes of `s` are read, so it can copy a slice out
+      of a longer string without measuring the rest of it.
+    - The caller is responsible for freeing the allocated memory.
+*/
+char	*ft_strndup(const char *s, size_t n)
+{
+	const char	*nul;
+	char		*dup;
+
+	nul = ft_memchr(s, '\0', n);
+	if (nul)
+		n = nul - s;
+	dup = (char *) malloc(n + 1);
+	if (!dup)
+		return (NULL);
+	ft_memcpy(dup, s, n);
+	dup[n] = '\0';
+	return (dup);
+}
@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/26 16:04:05 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 13:55:10 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:10:23 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -36,9 +36,11 @@ RETURN VALUES
       function returns NULL.
 
 NOTES
-    - Both `big` and `little` must be null-terminated strings.
-    - The comparison stops at the first mismatch, end of `big`, or after
-      `len` characters, whichever comes first.
+    - Both `big` and `little` must be null-terminated strings, although
+      `big` only needs to be readable up to `len` bytes or its terminator.
+    - The searchable part of `big` is measured with ft_memchr and then
+      handed to ft_memmem, so the search runs in linear time (sublinear on
+      typical text) instead of comparing `little` at every position.
 
 BUGS
     The function assumes `big` and `little` are valid pointers. If either is
@@ -46,23 +48,12 @@ BUGS
 */
 char	*ft_strnstr(const char *big, const char *little, size_t len)
 {
-	size_t	i;
-	size_t	j;
+	const char	*nul;
 
-	i = 0;
-	j = 0;
 	if (little[0] == 0)
 		return ((char *) big);
-	while (big[i] && i < len)
-	{
-		while ((big[i + j] == little[j]) && big[i + j] && i + j < len)
-		{
-			j++;
-			if (little[j] == 0)
-				return ((char *) big + i);
-		}
-		i++;
-		j = 0;
-	}
-	return (0);
+	nul = ft_memchr(big, '\0', len);
+	if (nul)
+		len = nul - big;
+	return (ft_memmem(big, len, little, ft_strlen(little)));
 }
@@ -6,11 +6,12 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/26 15:52:31 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 22:33:59 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:11 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
+#include "ft_simd.h"
 
 /*
 NAME
@@ -34,6 +35,8 @@ NOTES
     - The input character `c` is cast to a char, allowing non-ASCII values to
       be processed, but the behavior for such values is undefined.
     - The function assumes that the input string `s` is null-terminated.
+    - The string is read once, a word or vector at a time with aligned
+      loads; only the block holding the terminator is resolved bytewise.
 
 BUGS
     If the input string `s` is NULL, the behavior is undefined. It is the
@@ -42,20 +45,5 @@ BUGS
 
 char	*ft_strrchr(const char *s, int c)
 {
-	unsigned int	i;
-	char			cc;
-	char			*current_cc;
-
-	cc = (char) c;
-	i = 0;
-	current_cc = NULL;
-	while (s[i])
-	{
-		if (s[i] == cc)
-			current_cc = (char *) &s[i];
-		i++;
-	}
-	if (s[i] == cc)
-		current_cc = (char *) &s[i];
-	return (current_cc);
+	return (ft_dispatch()->strrchr(s, (char) c));
 }
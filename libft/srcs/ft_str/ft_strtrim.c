@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/27 19:46:55 by fyudris           #+#    #+#             */
-/*   Updated: 2024/12/09 14:25:53 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 13:13:52 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -34,56 +34,26 @@ RETURN VALUES
 NOTES
     - The caller is responsible for freeing the allocated memory.
     - If either `s1` or `set` is NULL, the function returns NULL.
+    - `set` is turned into a t_byteset once, so each byte costs O(1)
+      however large the set is, and the leading run is classified 16 or
+      32 bytes at a time.
 
 BUGS
     The function assumes that `s1` and `set` are valid null-terminated strings.
     Passing invalid pointers leads to undefined behavior.
 */
-static int	is_to_trim(const char *set, char c)
-{
-	int	i;
-
-	i = 0;
-	while (set[i])
-	{
-		if (set[i] == c)
-			return (1);
-		i++;
-	}
-	return (0);
-}
-
-static char	*create_trimstr(const char *s1, size_t start, size_t len)
-{
-	char	*str;
-	size_t	i;
-
-	if (len <= 0 || start >= ft_strlen(s1))
-		return (ft_strdup(""));
-	str = ft_calloc(len + 1, sizeof(char));
-	if (!str)
-		return (NULL);
-	i = 0;
-	while (i < len)
-	{
-		str[i] = s1[start + i];
-		i++;
-	}
-	return (str);
-}
-
 char	*ft_strtrim(char const *s1, char const *set)
 {
-	int	i;
-	int	j;
+	t_byteset	trim;
+	size_t		len;
+	size_t		start;
 
 	if (!s1 || !set)
 		return (NULL);
-	i = 0;
-	j = ft_strlen(s1) - 1;
-	while (s1[i] && is_to_trim(set, s1[i]))
-		i++;
-	while (j >= i && is_to_trim(set, s1[j]))
-		j--;
-	return (create_trimstr(s1, i, j - i + 1));
+	ft_byteset_init(&trim, set);
+	len = ft_strlen(s1);
+	start = ft_byteset_span(&trim, s1, len);
+	len -= start;
+	len -= ft_byteset_rspan(&trim, s1 + start, len);
+	return (ft_strndup(s1 + start, len));
 }
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_tokenizer.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:14:23 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:47:28 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_tok_init, ft_tok_next -- iterate over the tokens of a buffer
+
+DESCRIPTION
+    A t_tokenizer walks the `len` bytes at `s` and yields each run of bytes
+    that are not in `delims` as a view: a pointer into the buffer and a
+    length. Nothing is copied or allocated, and the buffer is not modified,
+    so the input may be a read-only string or a binary message buffer.
+
+    ft_tok_init prepares the iterator; ft_tok_next stores the next token in
+    `*token` and `*token_len`. ft_tok_count counts the tokens left without
+    moving the iterator, which is how the ft_split family sizes its arrays.
+
+PARAMETERS
+    tok: The iterator state.
+    s: The buffer to tokenize; it must outlive the iterator.
+    len: Number of bytes in `s` (use ft_strlen for a string).
+    delims: Null-terminated set of delimiter characters.
+    token, token_len: Receive the next token; tokens are not terminated.
+
+RETURN VALUES
+    ft_tok_next returns 1 when it produced a token and 0 once the buffer is
+    exhausted. ft_tok_count returns the number of tokens left.
+
+NOTES
+    - The buffer is read once, with runs measured by ft_byteset_span and
+      ft_byteset_cspan.
+    - Empty tokens are never produced: consecutive delimiters count as one.
+*/
+void	ft_tok_init(t_tokenizer *tok, const char *s, size_t len,
+		const char *delims)
+{
+	tok->pos = s;
+	tok->left = len;
+	ft_byteset_init(&tok->delims, delims);
+}
+
+int	ft_tok_next(t_tokenizer *tok, const char **token, size_t *token_len)
+{
+	size_t	n;
+
+	n = ft_byteset_span(&tok->delims, tok->pos, tok->left);
+	tok->pos += n;
+	tok->left -= n;
+	if (tok->left == 0)
+		return (0);
+	n = ft_byteset_cspan(&tok->delims, tok->pos, tok->left);
+	*token = tok->pos;
+	*token_len = n;
+	tok->pos += n;
+	tok->left -= n;
+	return (1);
+}
+
+size_t	ft_tok_count(const t_tokenizer *tok)
+{
+	t_tokenizer	walk;
+	const char	*token;
+	size_t		token_len;
+	size_t		count;
+
+	walk = *tok;
+	count = 0;
+	while (ft_tok_next(&walk, &token, &token_len))
+		count++;
+	return (count);
+}
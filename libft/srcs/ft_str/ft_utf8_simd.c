@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_utf8_simd.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:05:55 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:05:55 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_simd.h"
+
+/*
+ * SSE2 and AVX2 kernels for ft_utf8_valid. A vector with no high bit set
+ * is all ASCII and is skipped whole; otherwise the ASCII prefix is skipped
+ * and the first multi-byte sequence is decoded with ft_utf8_seq. The tail
+ * shorter than a vector goes to the word kernel.
+ */
+#if FT_X86_SIMD
+
+int	ft_utf8_valid_sse2(const unsigned char *s, size_t n)
+{
+	unsigned int	mask;
+	size_t			len;
+
+	while (n >= 16)
+	{
+		mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)s));
+		len = 16;
+		if (mask)
+		{
+			s += __builtin_ctz(mask);
+			n -= __builtin_ctz(mask);
+			len = ft_utf8_seq(s, n);
+			if (len == 0)
+				return (0);
+		}
+		s += len;
+		n -= len;
+	}
+	return (ft_utf8_valid_word(s, n));
+}
+
+FT_AVX2
+int	ft_utf8_valid_avx2(const unsigned char *s, size_t n)
+{
+	unsigned int	mask;
+	size_t			len;
+
+	while (n >= 32)
+	{
+		mask = _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *)s));
+		len = 32;
+		if (mask)
+		{
+			s += __builtin_ctz(mask);
+			n -= __builtin_ctz(mask);
+			len = ft_utf8_seq(s, n);
+			if (len == 0)
+				return (0);
+		}
+		s += len;
+		n -= len;
+	}
+	return (ft_utf8_valid_word(s, n));
+}
+
+#endif
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_utf8_valid.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:05:55 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:05:55 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "ft_simd.h"
+
+/*
+NAME
+    ft_utf8_valid -- check that a byte string is well-formed UTF-8
+
+DESCRIPTION
+    The ft_utf8_valid function checks the first `n` bytes of `s` against the
+    UTF-8 encoding rules of RFC 3629: no overlong forms, no surrogates
+    (U+D800..U+DFFF), nothing above U+10FFFF and no truncated sequence at
+    the end. NUL bytes are valid ASCII and do not end the check.
+
+PARAMETERS
+    s: Pointer to the bytes to check.
+    n: Number of bytes to check.
+
+RETURN VALUES
+    Returns 1 if the bytes are valid UTF-8 (including n == 0), 0 otherwise.
+
+NOTES
+    - ASCII runs are skipped a word or a vector at a time; only multi-byte
+      sequences are decoded byte by byte.
+*/
+
+/* Sets the range allowed for the second byte after the lead byte c */
+static size_t	lead_length(unsigned char c, unsigned char *lo,
+		unsigned char *hi)
+{
+	*lo = 0x80;
+	*hi = 0xBF;
+	if (c == 0xE0)
+		*lo = 0xA0;
+	else if (c == 0xED)
+		*hi = 0x9F;
+	else if (c == 0xF0)
+		*lo = 0x90;
+	else if (c == 0xF4)
+		*hi = 0x8F;
+	if (c >= 0xC2 && c <= 0xDF)
+		return (2);
+	if (c >= 0xE0 && c <= 0xEF)
+		return (3);
+	if (c >= 0xF0 && c <= 0xF4)
+		return (4);
+	return (0);
+}
+
+/* Length of the valid multi-byte sequence at s, 0 if it is invalid */
+size_t	ft_utf8_seq(const unsigned char *s, size_t n)
+{
+	unsigned char	lo;
+	unsigned char	hi;
+	size_t			len;
+	size_t			i;
+
+	len = lead_length(s[0], &lo, &hi);
+	if (len == 0 || n < len || s[1] < lo || s[1] > hi)
+		return (0);
+	i = 2;
+	while (i < len)
+	{
+		if ((s[i] & 0xC0) != 0x80)
+			return (0);
+		i++;
+	}
+	return (len);
+}
+
+int	ft_utf8_valid_word(const unsigned char *s, size_t n)
+{
+	size_t	len;
+
+	while (n > 0)
+	{
+		len = 1;
+		if (n >= WORD_SIZE && !(*(const t_uword *)s & WORD_HIGHS))
+			len = WORD_SIZE;
+		else if (*s >= 0x80)
+			len = ft_utf8_seq(s, n);
+		if (len == 0)
+			return (0);
+		s += len;
+		n -= len;
+	}
+	return (1);
+}
+
+int	ft_utf8_valid(const char *s, size_t n)
+{
+	if (!s)
+		return (n == 0);
+	return (ft_dispatch()->utf8_valid((const unsigned char *)s, n));
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strbuf.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:18:45 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:26:47 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "ft_map.h"
+
+/*
+NAME
+    ft_strbuf -- growable byte string
+
+DESCRIPTION
+    A t_strbuf owns `cap` bytes at `data`, of which the first `len` are in
+    use. Appends grow the storage geometrically, so building a string of n
+    bytes costs O(n) copying in total. One byte beyond `len` is always kept
+    free so that ft_sb_cstr can terminate the contents without growing.
+
+    ft_sb_init makes an empty builder that owns no memory.
+    ft_sb_reserve makes room for `extra` more bytes.
+    ft_sb_shrink gives unused capacity back (see ft_strbuf_shrink.c).
+    ft_sb_clear empties the builder but keeps its storage for reuse.
+    ft_sb_free releases the storage and leaves an empty builder.
+
+RETURN VALUES
+    ft_sb_reserve and ft_sb_shrink return 0 on success and -1 if memory
+    could not be allocated; the contents are unchanged on failure.
+
+NOTES
+    - Up to FT_MAP_THRESHOLD (1 MiB) growth goes through realloc(), not
+      ft_realloc, so the allocator can extend a block in place.
+    - Beyond that the storage moves to an anonymous mapping of its own
+      (`mapped` is set) and grows with mremap(): the kernel moves the pages
+      instead of copying the bytes, and the peak memory of a resize stays
+      at the new size. The mapping asks for transparent huge pages.
+    - ft_sb_clear on a mapped builder discards its pages (MADV_DONTNEED),
+      so a finished multi-megabyte message stops holding memory at once
+      while the address range stays ready for the next one.
+    - The contents are not NUL-terminated between appends; use ft_sb_cstr.
+*/
+void	ft_sb_init(t_strbuf *sb)
+{
+	sb->data = NULL;
+	sb->len = 0;
+	sb->cap = 0;
+	sb->mapped = 0;
+}
+
+/* Moves the storage to a mapping, or grows the mapping, to hold cap bytes */
+static int	grow_mapped(t_strbuf *sb, size_t cap)
+{
+	char	*data;
+
+	cap = ft_map_round(cap);
+	if (sb->mapped)
+		data = ft_map_resize(sb->data, sb->cap, cap);
+	else
+	{
+		data = ft_map_alloc(cap);
+		if (data && sb->len > 0)
+			ft_memcpy(data, sb->data, sb->len);
+		if (data)
+			free(sb->data);
+	}
+	if (!data)
+		return (-1);
+	sb->data = data;
+	sb->cap = cap;
+	sb->mapped = 1;
+	return (0);
+}
+
+int	ft_sb_reserve(t_strbuf *sb, size_t extra)
+{
+	size_t	need;
+	size_t	cap;
+	char	*data;
+
+	if (extra >= SIZE_MAX / 2 - sb->len)
+		return (-1);
+	need = sb->len + extra + 1;
+	if (need <= sb->cap)
+		return (0);
+	cap = FT_SB_MIN_CAPACITY;
+	if (sb->cap > cap)
+		cap = sb->cap;
+	while (cap < need)
+		cap *= 2;
+	if (cap > FT_MAP_THRESHOLD)
+		return (grow_mapped(sb, cap));
+	data = (char *) realloc(sb->data, cap);
+	if (!data)
+		return (-1);
+	sb->data = data;
+	sb->cap = cap;
+	return (0);
+}
+
+void	ft_sb_clear(t_strbuf *sb)
+{
+	sb->len = 0;
+	if (sb->mapped)
+		ft_map_discard(sb->data, sb->cap);
+}
+
+void	ft_sb_free(t_strbuf *sb)
+{
+	if (sb->mapped)
+		ft_map_free(sb->data, sb->cap);
+	else
+		free(sb->data);
+	ft_sb_init(sb);
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strbuf_append.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:18:45 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:29:38 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_sb_append_bytes, ft_sb_append_char, ft_sb_append_str,
+    ft_sb_append_u64, ft_sb_cstr -- add to a t_strbuf
+
+DESCRIPTION
+    The append functions add `n` bytes, one character, a string, or the
+    decimal digits of `n` to the end of the builder, growing it as needed.
+    Bulk appends make room once and copy with ft_memcpy.
+
+    ft_sb_cstr terminates the contents with a NUL and returns them.
+
+RETURN VALUES
+    The append functions return 0 on success and -1 if memory could not be
+    allocated, leaving the builder unchanged.
+    ft_sb_cstr returns the NUL-terminated contents, or NULL if the builder
+    owns no memory and none could be allocated.
+*/
+int	ft_sb_append_bytes(t_strbuf *sb, const void *s, size_t n)
+{
+	if (n == 0)
+		return (0);
+	if (ft_sb_reserve(sb, n) == -1)
+		return (-1);
+	ft_memcpy(sb->data + sb->len, s, n);
+	sb->len += n;
+	return (0);
+}
+
+int	ft_sb_append_char(t_strbuf *sb, char c)
+{
+	if (sb->len + 1 >= sb->cap && ft_sb_reserve(sb, 1) == -1)
+		return (-1);
+	sb->data[sb->len++] = c;
+	return (0);
+}
+
+int	ft_sb_append_str(t_strbuf *sb, const char *s)
+{
+	return (ft_sb_append_bytes(sb, s, ft_strlen(s)));
+}
+
+int	ft_sb_append_u64(t_strbuf *sb, uint64_t n)
+{
+	char	digits[FT_FMT_BUFSIZE];
+
+	return (ft_sb_append_bytes(sb, digits, ft_fmt_u64(digits, n)));
+}
+
+char	*ft_sb_cstr(t_strbuf *sb)
+{
+	if (!sb->data && ft_sb_reserve(sb, 0) == -1)
+		return (NULL);
+	sb->data[sb->len] = '\0';
+	return (sb->data);
+}
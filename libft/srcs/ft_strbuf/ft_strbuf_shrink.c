@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strbuf_shrink.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:26:05 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:26:05 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "ft_map.h"
+
+/*
+NAME
+    ft_sb_shrink -- give the unused capacity of a t_strbuf back
+
+DESCRIPTION
+    Reduces the storage to the contents plus the terminator byte. A mapped
+    builder whose contents now fit below FT_MAP_THRESHOLD moves back to the
+    heap; a larger one is trimmed to whole pages with ft_map_resize.
+
+RETURN VALUES
+    Returns 0 on success and -1 if memory could not be allocated, in which
+    case the builder is unchanged.
+*/
+static int	shrink_mapped(t_strbuf *sb)
+{
+	char	*data;
+	size_t	cap;
+
+	cap = sb->len + 1;
+	if (cap > FT_MAP_THRESHOLD)
+	{
+		cap = ft_map_round(cap);
+		if (cap == sb->cap)
+			return (0);
+		data = ft_map_resize(sb->data, sb->cap, cap);
+		if (!data)
+			return (-1);
+		sb->data = data;
+		sb->cap = cap;
+		return (0);
+	}
+	data = (char *) malloc(cap);
+	if (!data)
+		return (-1);
+	ft_memcpy(data, sb->data, sb->len);
+	ft_map_free(sb->data, sb->cap);
+	sb->data = data;
+	sb->cap = cap;
+	sb->mapped = 0;
+	return (0);
+}
+
+int	ft_sb_shrink(t_strbuf *sb)
+{
+	char	*data;
+
+	if (sb->mapped)
+		return (shrink_mapped(sb));
+	if (!sb->data || sb->len + 1 == sb->cap)
+		return (0);
+	data = (char *) realloc(sb->data, sb->len + 1);
+	if (!data)
+		return (-1);
+	sb->data = data;
+	sb->cap = sb->len + 1;
+	return (0);
+}
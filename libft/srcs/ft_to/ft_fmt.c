@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_fmt.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:28:12 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:28:12 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+/*
+NAME
+    ft_fmt_u64, ft_fmt_i64, ft_fmt_hex -- format an integer into a buffer
+
+DESCRIPTION
+    These functions write the digits of `n` to `buf`: base 10 for
+    ft_fmt_u64 and ft_fmt_i64 (with a leading '-' when negative), base 16
+    for ft_fmt_hex (upper-case letters when `upper` is non-zero). The
+    length is worked out first from the bit length and a table of powers
+    of ten, then the digits are stored from the right,
+    two at a time from a 200-byte table of "00" to "99", which halves the
+    number of divisions.
+
+    They are the formatting core behind ft_itoa, ft_putnbr_fd, the
+    ft_printf conversions, ft_bw_putnbr and ft_sb_append_u64.
+
+PARAMETERS
+    buf: Destination with room for at least FT_FMT_BUFSIZE bytes.
+    n: The value to format.
+    upper: Non-zero for "ABCDEF" instead of "abcdef" (ft_fmt_hex).
+
+RETURN VALUES
+    The number of bytes written. The result is not NUL-terminated.
+*/
+static const char	g_digit_pairs[201] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+static const uint64_t	g_powers_of_ten[20] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+	10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+	100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL,
+	10000000000000000000ULL
+};
+
+/* Number of decimal digits: log10 estimated from the bit length, then fixed */
+static size_t	u64_length(uint64_t n)
+{
+	size_t	guess;
+
+	guess = ((64 - __builtin_clzll(n | 1)) * 1233) >> 12;
+	return (guess + ((n | 1) >= g_powers_of_ten[guess]));
+}
+
+size_t	ft_fmt_u64(char *buf, uint64_t n)
+{
+	size_t	len;
+	size_t	i;
+	size_t	pair;
+
+	len = u64_length(n);
+	i = len;
+	while (n >= 100)
+	{
+		pair = (n % 100) * 2;
+		n /= 100;
+		buf[--i] = g_digit_pairs[pair + 1];
+		buf[--i] = g_digit_pairs[pair];
+	}
+	if (n >= 10)
+	{
+		buf[1] = g_digit_pairs[n * 2 + 1];
+		buf[0] = g_digit_pairs[n * 2];
+	}
+	else
+		buf[0] = '0' + n;
+	return (len);
+}
+
+size_t	ft_fmt_i64(char *buf, int64_t n)
+{
+	if (n >= 0)
+		return (ft_fmt_u64(buf, (uint64_t) n));
+	buf[0] = '-';
+	return (1 + ft_fmt_u64(buf + 1, -(uint64_t) n));
+}
+
+size_t	ft_fmt_hex(char *buf, uint64_t n, int upper)
+{
+	const char	*digits;
+	size_t		len;
+	size_t		i;
+
+	digits = "0123456789abcdef";
+	if (upper)
+		digits = "0123456789ABCDEF";
+	len = 1;
+	if (n != 0)
+		len = (67 - __builtin_clzll(n)) / 4;
+	i = len;
+	while (i > 0)
+	{
+		buf[--i] = digits[n & 0xF];
+		n >>= 4;
+	}
+	return (len);
+}
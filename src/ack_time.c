@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ack_time.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:29:41 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:29:41 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../includes/minitalk.h"
+
+/**
+ * @brief How long a client waits for an ACK: ACK_TIMEOUT_MS, or the number
+ * of milliseconds in $MINITALK_ACK_TIMEOUT_MS when it is a plain positive
+ * number.
+ */
+long	ack_timeout_ms(void)
+{
+	const char	*env;
+	long		ms;
+	int			i;
+
+	env = getenv(ACK_TIMEOUT_ENV);
+	if (!env || !*env)
+		return (ACK_TIMEOUT_MS);
+	ms = 0;
+	i = 0;
+	while (ft_isdigit(env[i]) && ms < 86400000L)
+		ms = ms * 10 + env[i++] - '0';
+	if (env[i] != '\0' || ms <= 0)
+		return (ACK_TIMEOUT_MS);
+	return (ms);
+}
+
+/**
+ * @brief Sets `deadline` to ack_timeout_ms() from now, on the monotonic
+ * clock.
+ */
+void	ack_deadline(struct timespec *deadline)
+{
+	long	ms;
+
+	ms = ack_timeout_ms();
+	clock_gettime(CLOCK_MONOTONIC, deadline);
+	deadline->tv_sec += ms / 1000;
+	deadline->tv_nsec += (ms % 1000) * 1000000L;
+	if (deadline->tv_nsec >= 1000000000L)
+	{
+		deadline->tv_sec++;
+		deadline->tv_nsec -= 1000000000L;
+	}
+}
+
+/**
+ * @brief Time left until `deadline`, as a timeout for sigtimedwait().
+ * @return 1 while time is left, 0 once the deadline has passed.
+ */
+int	ack_time_left(const struct timespec *deadline, struct timespec *left)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	left->tv_sec = deadline->tv_sec - now.tv_sec;
+	left->tv_nsec = deadline->tv_nsec - now.tv_nsec;
+	if (left->tv_nsec < 0)
+	{
+		left->tv_sec--;
+		left->tv_nsec += 1000000000L;
+	}
+	return (left->tv_sec >= 0);
+}
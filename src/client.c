@@ -6,135 +6,110 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/03 14:45:25 by fyudris           #+#    #+#             */
-/*   Updated: 2025/06/05 21:02:02 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 14:37:05 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include <errno.h>
 #include "../includes/minitalk.h"
 
 /**
- * @brief Global flag to indicate acknowledgment from the server (Bonus feature).
- *
- * Justification (as required by Minitalk subject):
- * For the bonus acknowledgment feature, the client must wait for a confirmation
- * signal from the server. This variable acts as the essential communication link
- * between the asynchronous signal handler (which receives the ACK) and the main
- * program flow (which waits for it). It is declared as `volatile sig_atomic_t`
- * to ensure safe access in the presence of signals. This is the single
- * permitted global variable for the client program.
+ * @brief (BONUS) Waits for the server's acknowledgment, then prints what
+ * happened. The ACK is collected with sigtimedwait() the moment it lands;
+ * its receipt must match the message (see wait_ack()).
+ * @return SUCCESS, or FAILURE on a timeout or a receipt mismatch.
  */
-static volatile sig_atomic_t	g_ack_received = 0;
-
-/**
- * @brief (BONUS) Signal handler for the client to receive acknowledgment.
- */
-static void	client_ack_handler(int sig)
-{
-	(void)sig;
-	g_ack_received = 1;
-}
-
-/**
- * @brief (BONUS) Waits for the final acknowledgment from the server.
- */
-static void	wait_for_final_ack(void)
+static int	wait_for_final_ack(pid_t server_pid, const char *message)
 {
-	int	timeout_seconds;
+	t_receipt	sent;
+	uint64_t	got;
 
-	if (BONUSB)
+	receipt_init(&sent, message, ft_strlen(message));
+	if (!BONUSB)
 	{
-		timeout_seconds = 5;
-		while (!g_ack_received && timeout_seconds > 0)
-		{
-			sleep(1);
-			timeout_seconds--;
-		}
-		if (g_ack_received)
-			ft_printf("Message delivered and acknowledged by server.\n");
-		else
-			ft_putstr_fd("Client: Timeout. No acknowledgment from server.\n",
-				FD_STDERR);
-	}
-	else
 		ft_printf("Message sent successfully.\n");
-}
-
-/**
- * @brief Sends the message string to the server character by character.
- */
-static void	send_message(pid_t server_pid, const char *message)
-{
-	int	i;
-	int	bit_index;
-	int	signal_to_send;
-
-	i = 0;
-	while (1)
+		return (SUCCESS);
+	}
+	if (wait_ack(server_pid, &sent, &got) == 0)
 	{
-		bit_index = 7;
-		while (bit_index >= 0)
-		{
-			if ((message[i] >> bit_index) & 1)
-				signal_to_send = SIG_BIT_ONE;
-			else
-				signal_to_send = SIG_BIT_ZERO;
-			if (kill(server_pid, signal_to_send) == -1)
-				exit(ft_putstr_fd("Error: Failed to send signal.\n", FD_STDERR));
-			usleep(500);
-			bit_index--;
-		}
-		if (message[i] == '\0')
-			break ;
-		i++;
+		ft_printf("Message delivered and acknowledged by server (%u bytes, "
+			"crc32c %x).\n", sent.len, sent.crc);
+		return (SUCCESS);
 	}
+	if (errno == EIO)
+		ft_dprintf(FD_STDERR, "Client: Receipt mismatch: server got %u bytes "
+			"(crc32c %x), %u were sent (crc32c %x).\n", (uint32_t)(got >> 32),
+			(uint32_t)got, sent.len, sent.crc);
+	else
+		ft_putstr_fd("Client: Timeout. No acknowledgment from server.\n",
+			FD_STDERR);
+	return (FAILURE);
 }
 
 /**
  * @brief Parses and validates command-line arguments.
+ * `client -g <pgid> <message>` broadcasts to every server of a process
+ * group; its target is returned as -pgid, ready for kill(). `-k <key>` and
+ * `-l` pick a registered server instead (see client_registry.c).
  * Exits on failure.
- * @return pid_t The validated server PID.
+ * @return pid_t The validated server PID, or minus the group ID.
  */
 static pid_t	parse_and_validate_args(int argc, char **argv)
 {
 	int		i;
 	pid_t	pid;
 
-	if (argc != 3)
-		exit(ft_printf("Usage: %s <server_pid> <message>\n", argv[0]));
+	pid = registry_target(argc, argv);
+	if (pid > 0)
+		return (pid);
+	if (argc != 3 && (argc != 4 || ft_strncmp(argv[1], "-g", 3) != 0))
+		exit(ft_printf("Usage: %s <server_pid> <message>\n"
+				"       %s -g <pgid> <message>\n       %s -l <message>\n"
+				"       %s -s <server_pid>... <message>\n"
+				"       %s -p <server_pid> [message...]\n"
+				"       %s -k <key> <message>\n",
+				argv[0], argv[0], argv[0], argv[0], argv[0], argv[0]));
 	i = 0;
-	while (argv[1][i])
-	{
-		if (!ft_isdigit(argv[1][i]))
-			exit(ft_printf("Error: PID must be numeric.\n"));
+	while (ft_isdigit(argv[argc - 2][i]))
 		i++;
-	}
-	pid = ft_atoi(argv[1]);
+	if (argv[argc - 2][i] != '\0')
+		exit(ft_printf("Error: PID must be numeric.\n"));
+	pid = ft_atoi(argv[argc - 2]);
 	if (pid <= 0)
 		exit(ft_printf("Error: Invalid PID.\n"));
+	if (argc == 4)
+		return (-pid);
 	return (pid);
 }
 
 /**
  * @brief Main function for the Minitalk client.
+ * A group target is reached with one kill(-pgid, ...) per bit; every
+ * member's ACK is then collected (see client_group.c). `-s` stripes the
+ * message across several servers (see client_stripe.c), `-p` pipelines
+ * many messages in one session (see client_pipeline.c). ACK signals stay
+ * blocked, to be collected with sigtimedwait() and their receipts checked.
  */
 int	main(int argc, char *argv[])
 {
-	pid_t				server_pid;
-	const char			*message;
-	struct sigaction	sa_ack;
+	pid_t		server_pid;
+	const char	*message;
+	t_group		group;
 
+	if (BONUSB && acks_hold() == -1)
+		return (FAILURE);
+	if (argc > 2 && ft_strncmp(argv[1], "-p", 3) == 0)
+		return (send_pipelined(argc, argv));
+	if (argc > 3 && ft_strncmp(argv[1], "-s", 3) == 0)
+		return (send_striped(argc - 3, argv + 2, argv[argc - 1]));
 	server_pid = parse_and_validate_args(argc, argv);
-	message = argv[2];
-	if (BONUSB)
-	{
-		sa_ack.sa_handler = client_ack_handler;
-		sa_ack.sa_flags = SA_RESTART;
-		sigemptyset(&sa_ack.sa_mask);
-		sigaction(SIG_ACK, &sa_ack, NULL);
-	}
+	message = argv[argc - 1];
+	if (server_pid < 0 && group_open(&group, -server_pid) == FAILURE)
+		return (FAILURE);
 	send_message(server_pid, message);
-	wait_for_final_ack();
-	return (SUCCESS);
+	if (server_pid < 0)
+		return (wait_for_group_acks(&group, message));
+	return (wait_for_final_ack(server_pid, message));
 }
 
 // /**
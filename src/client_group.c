@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   client_group.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:55:21 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 13:55:21 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <dirent.h>
+#include <fcntl.h>
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Reads the process group of a process from /proc/<pid>/stat,
+ * whose fields after the command name are "state ppid pgrp ...".
+ * @return The process group, or -1 if the process is gone.
+ */
+static pid_t	proc_pgrp(const char *pid)
+{
+	char	path[64];
+	char	stat[512];
+	ssize_t	n;
+	int		fd;
+	char	*fields;
+
+	ft_snprintf(path, sizeof(path), "/proc/%s/stat", pid);
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (-1);
+	n = read(fd, stat, sizeof(stat) - 1);
+	close(fd);
+	if (n <= 0)
+		return (-1);
+	stat[n] = '\0';
+	fields = ft_strrchr(stat, ')');
+	if (!fields || ft_strlen(fields) < 4)
+		return (-1);
+	fields = ft_strchr(fields + 4, ' ');
+	if (!fields)
+		return (-1);
+	return (ft_atoi(fields + 1));
+}
+
+/**
+ * @brief Lists the processes of the group by scanning /proc.
+ * @return The number of members, or -1 if /proc cannot be read.
+ */
+static int	list_members(t_group *group)
+{
+	DIR				*proc;
+	struct dirent	*entry;
+
+	proc = opendir("/proc");
+	if (!proc)
+		return (-1);
+	entry = readdir(proc);
+	while (entry && group->count < GROUP_MAX_MEMBERS)
+	{
+		if (ft_isdigit(entry->d_name[0])
+			&& proc_pgrp(entry->d_name) == group->pgid)
+			group->members[group->count++] = ft_atoi(entry->d_name);
+		entry = readdir(proc);
+	}
+	closedir(proc);
+	return (group->count);
+}
+
+/**
+ * @brief Prepares a broadcast to the process group `pgid`: lists its
+ * members, so the ACKs can be matched against them later, and blocks
+ * SIG_GROUP_ACK so that ACKs arriving during the send wait in the queue.
+ * @return SUCCESS, or FAILURE if the group has no member or holds the
+ * client itself (kill(-pgid, ...) would hit it too).
+ */
+int	group_open(t_group *group, pid_t pgid)
+{
+	sigset_t	acks;
+
+	ft_bzero(group, sizeof(*group));
+	group->pgid = pgid;
+	if (getpgrp() == pgid || list_members(group) <= 0)
+	{
+		ft_dprintf(FD_STDERR, "Error: no servers to broadcast to in "
+			"process group %d.\n", pgid);
+		return (FAILURE);
+	}
+	sigemptyset(&acks);
+	sigaddset(&acks, SIG_GROUP_ACK);
+	sigprocmask(SIG_BLOCK, &acks, NULL);
+	return (SUCCESS);
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   client_group_ack.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:55:53 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:37:05 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Prints the outcome of a broadcast, naming the stragglers: members
+ * that did not acknowledge in time, exited meanwhile, or acknowledged with
+ * the receipt of another message (`acked` is then 2).
+ * @return SUCCESS if every member acknowledged intact, FAILURE otherwise.
+ */
+static int	report_group(const t_group *group)
+{
+	int	acked;
+	int	i;
+
+	acked = 0;
+	i = -1;
+	while (++i < group->count)
+		acked += (group->acked[i] == 1);
+	ft_printf("Message sent to group %d: %d/%d servers acknowledged.\n",
+		group->pgid, acked, group->count);
+	i = -1;
+	while (++i < group->count)
+	{
+		if (group->acked[i] == 2)
+			ft_dprintf(FD_STDERR, "Client: server %d: receipt mismatch.\n",
+				group->members[i]);
+		else if (!group->acked[i] && kill(group->members[i], 0) == -1)
+			ft_dprintf(FD_STDERR, "Client: server %d exited.\n",
+				group->members[i]);
+		else if (!group->acked[i])
+			ft_dprintf(FD_STDERR, "Client: server %d did not acknowledge.\n",
+				group->members[i]);
+	}
+	return (acked < group->count);
+}
+
+/**
+ * @brief Marks the member that sent the ACK `info` as answered: 1 if its
+ * receipt is `expected`, 2 if it got something else.
+ * @return 1 if this is the first ACK of a member, 0 otherwise.
+ */
+static int	record_ack(t_group *group, const siginfo_t *info,
+		uint64_t expected)
+{
+	int	i;
+
+	i = 0;
+	while (i < group->count && group->members[i] != info->si_pid)
+		i++;
+	if (i == group->count || group->acked[i])
+		return (0);
+	group->acked[i] = 1 + (receipt_received(info) != expected);
+	return (1);
+}
+
+/**
+ * @brief (BONUS) Collects one SIG_GROUP_ACK per member, until
+ * ack_timeout_ms() after the last bit. Real-time signals queue, so ACKs
+ * sent at the same moment by several servers are all counted, and each
+ * carries the receipt of its server, checked against `message`.
+ * @return SUCCESS if every member acknowledged intact, FAILURE otherwise.
+ */
+int	wait_for_group_acks(t_group *group, const char *message)
+{
+	sigset_t		acks;
+	siginfo_t		info;
+	t_receipt		sent;
+	struct timespec	deadline;
+	struct timespec	left;
+	int				answered;
+
+	if (!BONUSB)
+		return (ft_printf("Message sent to %d servers in group %d.\n",
+				group->count, group->pgid) < 0);
+	receipt_init(&sent, message, ft_strlen(message));
+	sigemptyset(&acks);
+	sigaddset(&acks, SIG_GROUP_ACK);
+	ack_deadline(&deadline);
+	answered = 0;
+	while (answered < group->count && ack_time_left(&deadline, &left))
+	{
+		if (sigtimedwait(&acks, &info, &left) == SIG_GROUP_ACK)
+			answered += record_ack(group, &info, receipt_value(&sent));
+	}
+	return (report_group(group));
+}
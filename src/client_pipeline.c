@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   client_pipeline.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:22:08 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:22:08 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include <errno.h>
+#include <string.h>
+#include "../includes/minitalk.h"
+
+static int	read_stdin(t_strbuf *text)
+{
+	ssize_t	n;
+
+	n = 1;
+	while (n > 0)
+	{
+		if (ft_sb_reserve(text, 65536) == -1)
+			return (-1);
+		n = read(STDIN_FILENO, text->data + text->len, 65536);
+		if (n > 0)
+			text->len += n;
+	}
+	return (-(n < 0));
+}
+
+/**
+ * @brief Sends every line of `text` as one message of the session. The
+ * empty remainder after a final newline is not a message.
+ * @return 0, or -1 (errno set) on failure; `sent` counts what went out.
+ */
+static int	send_lines(t_mt_conn *conn, const t_strbuf *text, long *sent)
+{
+	const char	*line;
+	const char	*end;
+	const char	*stop;
+
+	line = text->data;
+	stop = text->data + text->len;
+	while (line < stop)
+	{
+		end = ft_memchr(line, '\n', stop - line);
+		if (!end)
+			end = stop;
+		if (mt_send(conn, line, end - line) == -1)
+			return (-1);
+		(*sent)++;
+		line = end + 1;
+	}
+	return (0);
+}
+
+static int	send_args(t_mt_conn *conn, char **messages, long *sent)
+{
+	while (*messages)
+	{
+		if (mt_send(conn, *messages, ft_strlen(*messages)) == -1)
+			return (-1);
+		(*sent)++;
+		messages++;
+	}
+	return (0);
+}
+
+static void	report(int failed, const char *pid_arg, long sent)
+{
+	if (failed)
+		ft_dprintf(FD_STDERR, "Error: Session to %s stopped after %d "
+			"messages: %s.\n", pid_arg, (int)sent, strerror(errno));
+	else if (BONUSB)
+		ft_printf("Session of %d messages delivered and acknowledged by "
+			"server.\n", (int)sent);
+	else
+		ft_printf("Session of %d messages sent successfully.\n", (int)sent);
+}
+
+/**
+ * @brief `client -p <server_pid> [message...]`: sends the messages, or
+ * every line of stdin when none is given, back to back in one pipelined
+ * session (see mt_session_begin()).
+ * @return SUCCESS, or FAILURE (error printed).
+ */
+int	send_pipelined(int argc, char **argv)
+{
+	t_mt_conn	*conn;
+	t_strbuf	text;
+	long		sent;
+	int			failed;
+
+	ft_sb_init(&text);
+	sent = 0;
+	conn = mt_open(ft_atoi(argv[2]));
+	failed = (!conn || mt_session_begin(conn) == -1);
+	if (!failed && argc > 3)
+		failed = (send_args(conn, argv + 3, &sent) == -1);
+	else if (!failed)
+		failed = (read_stdin(&text) == -1
+				|| send_lines(conn, &text, &sent) == -1);
+	if (!failed)
+		failed = (mt_session_end(conn) == -1);
+	report(failed, argv[2], sent);
+	mt_close(conn);
+	ft_sb_free(&text);
+	return (failed);
+}
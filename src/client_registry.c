@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   client_registry.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:03:12 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:56:41 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Tells whether the entry open on `fd` belongs to a running server.
+ * A registered server holds an exclusive flock() on its entry for its
+ * whole life, and the kernel releases it however the server ends, SIGKILL
+ * included. A live PID proves nothing: it may have been reused by an
+ * unrelated process, which SIGUSR1 would kill. An entry that can be
+ * locked is stale and is removed, unless a new server has meanwhile
+ * renamed its own entry over it.
+ * @return 1 if the entry's server is alive, 0 otherwise.
+ */
+static int	entry_live(int fd, const char *path)
+{
+	struct stat	opened;
+	struct stat	current;
+
+	if (flock(fd, LOCK_SH | LOCK_NB) == -1)
+		return (errno == EWOULDBLOCK);
+	if (fstat(fd, &opened) == 0 && stat(path, &current) == 0
+		&& opened.st_dev == current.st_dev && opened.st_ino == current.st_ino)
+		unlink(path);
+	return (0);
+}
+
+/**
+ * @brief Reads the load figure of the registered server `name` (its PID).
+ * @return 1 if the server is alive and its entry readable, 0 otherwise.
+ */
+static int	read_entry(const char *name, long *busy, long *done)
+{
+	char	path[REGISTRY_PATH_MAX];
+	char	record[REGISTRY_RECORD + 1];
+	ssize_t	n;
+	int		fd;
+
+	if (registry_path(path, name) == FAILURE)
+		return (0);
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (0);
+	n = -1;
+	if (entry_live(fd, path))
+		n = read(fd, record, REGISTRY_RECORD);
+	close(fd);
+	if (n != REGISTRY_RECORD)
+		return (0);
+	record[n] = '\0';
+	*busy = ft_atol(record);
+	*done = ft_atol(record + REGISTRY_FIELD + 1);
+	return (1);
+}
+
+/**
+ * @brief Keeps `pid` if it beats the current pick: nearer to the key on
+ * the ring, or, without a key, fewer messages in progress and then fewer
+ * messages received so far.
+ */
+static void	consider(t_registry_pick *pick, pid_t pid, long busy, long done)
+{
+	uint32_t	distance;
+
+	distance = 0;
+	if (pick->key)
+		distance = ring_distance(pid, pick->key_hash);
+	if (pick->pid == 0 || (pick->key && distance < pick->distance)
+		|| (!pick->key && (busy < pick->busy
+				|| (busy == pick->busy && done < pick->done))))
+	{
+		pick->pid = pid;
+		pick->distance = distance;
+		pick->busy = busy;
+		pick->done = done;
+	}
+}
+
+/**
+ * @brief Picks a live server from the registry, by key or by load.
+ * @return The server's PID, or 0 if no live server is registered.
+ */
+static pid_t	registry_pick(const char *key)
+{
+	t_registry_pick	pick;
+	DIR				*dir;
+	struct dirent	*entry;
+	long			busy;
+	long			done;
+
+	ft_bzero(&pick, sizeof(pick));
+	pick.key = key;
+	if (key)
+		pick.key_hash = ring_hash(ft_crc32(0, key, ft_strlen(key)));
+	dir = opendir(registry_dir());
+	if (!dir)
+		return (0);
+	entry = readdir(dir);
+	while (entry)
+	{
+		if (ft_isdigit(entry->d_name[0])
+			&& read_entry(entry->d_name, &busy, &done))
+			consider(&pick, ft_atoi(entry->d_name), busy, done);
+		entry = readdir(dir);
+	}
+	closedir(dir);
+	return (pick.pid);
+}
+
+/**
+ * @brief Resolves `client -k <key> <message>` (consistent hashing: a key
+ * always lands on the same server while the fleet does not change) and
+ * `client -l <message>` (least loaded server). Exits if the registry has
+ * no live server.
+ * @return The chosen server, or 0 if the arguments name no registry target.
+ */
+pid_t	registry_target(int argc, char **argv)
+{
+	pid_t	pid;
+
+	if (argc == 4 && ft_strncmp(argv[1], "-k", 3) == 0)
+		pid = registry_pick(argv[2]);
+	else if (argc == 3 && ft_strncmp(argv[1], "-l", 3) == 0)
+		pid = registry_pick(NULL);
+	else
+		return (0);
+	if (pid == 0)
+		exit(ft_printf("Error: no live server registered in %s.\n",
+				registry_dir()));
+	return (pid);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   client_send.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:58:34 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:00:32 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Sends the lowest `nbits` bits of `value` to the server, most
+ * significant bit first, waiting `delay_us` after each signal.
+ * @return 0, or -1 (errno set by kill) when a signal cannot be sent.
+ */
+static int	send_bits(pid_t server_pid, unsigned long long value, int nbits,
+		int delay_us)
+{
+	int	signal_to_send;
+
+	while (nbits-- > 0)
+	{
+		if ((value >> nbits) & 1)
+			signal_to_send = SIG_BIT_ONE;
+		else
+			signal_to_send = SIG_BIT_ZERO;
+		if (kill(server_pid, signal_to_send) == -1)
+			return (-1);
+		usleep(delay_us);
+	}
+	return (0);
+}
+
+/**
+ * @brief (FEC) Sends `len` bytes and the terminator as SECDED blocks.
+ * The last block is padded with NULs, and every block is followed by a
+ * pause so the server can tell where a short block ends.
+ */
+static int	send_bytes_fec(pid_t server_pid, const unsigned char *buf,
+		size_t len)
+{
+	unsigned char	block[FEC_BLOCK_BYTES];
+	size_t			chunk;
+	size_t			i;
+
+	i = 0;
+	while (i <= len)
+	{
+		chunk = len - i;
+		if (chunk > FEC_BLOCK_BYTES)
+			chunk = FEC_BLOCK_BYTES;
+		ft_bzero(block, FEC_BLOCK_BYTES);
+		ft_memcpy(block, buf + i, chunk);
+		if (send_bits(server_pid, fec_encode_block(block), FEC_BLOCK_BITS,
+				FEC_BIT_DELAY_US) == -1)
+			return (-1);
+		usleep(FEC_BLOCK_GAP_US);
+		i += FEC_BLOCK_BYTES;
+	}
+	return (0);
+}
+
+/**
+ * @brief Sends `len` bytes as they are, without ending the message: the
+ * building block of pipelined sessions. Not usable in FEC builds, where
+ * bytes only travel in whole blocks.
+ * @return 0, or -1 (errno set by kill) when a signal cannot be sent.
+ */
+int	send_raw(pid_t server_pid, const void *buf, size_t len)
+{
+	const unsigned char	*bytes;
+	size_t				i;
+
+	bytes = buf;
+	i = 0;
+	while (i < len)
+	{
+		if (send_bits(server_pid, bytes[i], 8, BIT_DELAY_US) == -1)
+			return (-1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Sends `len` bytes followed by the NUL terminator that ends a
+ * message. `buf` must not contain a NUL of its own, nor start with
+ * PIPELINE_OPEN, which the server would take for a pipelined session.
+ * @return 0, or -1 with errno set: EINVAL for a leading PIPELINE_OPEN, or
+ * the error of kill() when a signal cannot be sent.
+ */
+int	send_bytes(pid_t server_pid, const void *buf, size_t len)
+{
+	if (len && *(const unsigned char *)buf == PIPELINE_OPEN)
+	{
+		errno = EINVAL;
+		return (-1);
+	}
+	if (FECB)
+		return (send_bytes_fec(server_pid, buf, len));
+	if (send_raw(server_pid, buf, len) == -1)
+		return (-1);
+	return (send_bits(server_pid, '\0', 8, BIT_DELAY_US));
+}
+
+/**
+ * @brief Sends the message string to the server character by character.
+ * Exits the client when the message starts with PIPELINE_OPEN or the
+ * server cannot be signalled.
+ */
+void	send_message(pid_t server_pid, const char *message)
+{
+	if (send_bytes(server_pid, message, ft_strlen(message)) == 0)
+		return ;
+	if (errno == EINVAL)
+		exit(ft_dprintf(FD_STDERR, "Error: A message cannot start with "
+				"byte 0x01, which opens a pipelined session.\n"));
+	exit(ft_dprintf(FD_STDERR,
+			"Error: Failed to send signal to %d.\n", server_pid));
+}
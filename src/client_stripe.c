@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   client_stripe.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:58:58 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:15:41 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <sys/wait.h>
+#include "../includes/minitalk.h"
+
+static int	append_field(t_strbuf *record, uint64_t n, char sep)
+{
+	if (ft_sb_append_u64(record, n) == -1
+		|| ft_sb_append_char(record, sep) == -1)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief (Child) Sends stripe `seq` of `send` to one server. Stripes are
+ * equal slices of the message, the last one shorter; the byte count in the
+ * header lets tools/merge cut a stripe out of the server's output even if
+ * it holds newlines.
+ * @return The exit status of the sender: 0 once the stripe is sent (and
+ * acknowledged, in the bonus build), 1 otherwise.
+ */
+static int	send_stripe(pid_t server_pid, const char *message,
+		const t_stripe_send *send, int seq)
+{
+	t_strbuf	record;
+	t_receipt	sent;
+	size_t		start;
+	size_t		size;
+
+	size = (send->len + send->count - 1) / send->count;
+	start = size * seq;
+	if (start > send->len)
+		start = send->len;
+	if (size > send->len - start)
+		size = send->len - start;
+	ft_sb_init(&record);
+	if (ft_sb_append_str(&record, STRIPE_TAG) == -1
+		|| append_field(&record, send->pid, '.') == -1
+		|| append_field(&record, send->stamp, ':') == -1
+		|| append_field(&record, seq, ':') == -1
+		|| append_field(&record, send->count, ':') == -1
+		|| append_field(&record, size, ':') == -1
+		|| ft_sb_append_bytes(&record, message + start, size) == -1)
+		return (1);
+	send_message(server_pid, ft_sb_cstr(&record));
+	receipt_init(&sent, record.data, record.len);
+	ft_sb_free(&record);
+	return (BONUSB && wait_ack(server_pid, &sent, NULL) == -1);
+}
+
+/**
+ * @brief Reads the server PIDs of a striped send.
+ * @return SUCCESS, or FAILURE (error printed) for a bad or too long list.
+ */
+static int	parse_pids(int count, char **pid_args, pid_t *pids)
+{
+	int	digits;
+	int	i;
+
+	i = 0;
+	while (i < count && count <= STRIPE_MAX_PIDS)
+	{
+		digits = 0;
+		while (ft_isdigit(pid_args[i][digits]))
+			digits++;
+		pids[i] = ft_atoi(pid_args[i]);
+		if (digits == 0 || digits > 9 || pid_args[i][digits] != '\0'
+			|| pids[i] <= 0)
+			break ;
+		i++;
+	}
+	if (i == count)
+		return (SUCCESS);
+	ft_putstr_fd("Error: invalid PID list.\n", FD_STDERR);
+	return (FAILURE);
+}
+
+/**
+ * @brief Reaps the senders and names the stripes that did not get through.
+ * @return The number of failed stripes.
+ */
+static int	wait_senders(const pid_t *senders, const pid_t *pids, int count)
+{
+	int	status;
+	int	failed;
+	int	i;
+
+	failed = 0;
+	i = 0;
+	while (i < count)
+	{
+		if (senders[i] < 0 || waitpid(senders[i], &status, 0) == -1
+			|| !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		{
+			ft_dprintf(FD_STDERR, "Client: stripe %d to %d failed.\n",
+				i, pids[i]);
+			failed++;
+		}
+		i++;
+	}
+	return (failed);
+}
+
+/**
+ * @brief Sends a message striped across `count` servers, one forked sender
+ * per server, so that the servers decode their shares in parallel. Every
+ * stripe carries the same id: this client's PID and its start time.
+ * tools/merge puts the stripes back together from the servers' output.
+ * @return SUCCESS if every stripe went through, FAILURE otherwise.
+ */
+int	send_striped(int count, char **pid_args, const char *message)
+{
+	pid_t			pids[STRIPE_MAX_PIDS];
+	pid_t			senders[STRIPE_MAX_PIDS];
+	t_stripe_send	send;
+	struct timespec	now;
+	int				i;
+
+	if (parse_pids(count, pid_args, pids) == FAILURE)
+		return (FAILURE);
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	send.pid = getpid();
+	send.stamp = now.tv_sec * 1000000000ULL + now.tv_nsec;
+	send.count = count;
+	send.len = ft_strlen(message);
+	i = 0;
+	while (i < count)
+	{
+		senders[i] = fork();
+		if (senders[i] == 0)
+			exit(send_stripe(pids[i], message, &send, i));
+		i++;
+	}
+	if (wait_senders(senders, pids, count) > 0)
+		return (FAILURE);
+	ft_printf("Message sent in %d stripes.\n", count);
+	return (SUCCESS);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fec.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:29:54 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:12:24 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minitalk.h"
+
+/*
+ * Forward error correction for the fire-and-forget transport (FECB builds).
+ *
+ * Every data nibble becomes one SECDED(8,4) codeword: the classic
+ * Hamming(7,4) code in bits 1..7 (bit i holds Hamming position i) plus an
+ * overall parity bit in bit 0. A block of FEC_BLOCK_BYTES bytes gives
+ * FEC_BLOCK_CODEWORDS codewords, which are interleaved bit-wise on the wire:
+ * first bit 0 of every codeword, then bit 1 of every codeword, and so on.
+ * A burst of up to FEC_BLOCK_CODEWORDS consecutive bad signals therefore
+ * damages each codeword at most once, and every single hit is correctable.
+ *
+ * The 64 interleaved bits are carried in an unsigned long long whose most
+ * significant bit is sent first, which is exactly how the server shifts them
+ * back in.
+ */
+
+static unsigned char	secded_encode(unsigned char nibble)
+{
+	unsigned char	d[4];
+	unsigned char	cw;
+	unsigned char	parity;
+
+	d[0] = nibble & 1;
+	d[1] = (nibble >> 1) & 1;
+	d[2] = (nibble >> 2) & 1;
+	d[3] = (nibble >> 3) & 1;
+	cw = ((d[0] ^ d[1] ^ d[3]) << 1) | ((d[0] ^ d[2] ^ d[3]) << 2)
+		| (d[0] << 3) | ((d[1] ^ d[2] ^ d[3]) << 4)
+		| (d[1] << 5) | (d[2] << 6) | (d[3] << 7);
+	parity = cw ^ (cw >> 4);
+	parity ^= parity >> 2;
+	parity ^= parity >> 1;
+	return (cw | (parity & 1));
+}
+
+/**
+ * @brief Decodes one SECDED(8,4) codeword in place.
+ * @return 0 if clean, 1 if a single error was corrected, -1 if the codeword
+ * holds a double error.
+ */
+static int	secded_decode(unsigned char *cw, unsigned char *nibble)
+{
+	int				syndrome;
+	int				parity;
+	int				pos;
+
+	syndrome = 0;
+	parity = *cw & 1;
+	pos = 1;
+	while (pos < 8)
+	{
+		if ((*cw >> pos) & 1)
+		{
+			syndrome ^= pos;
+			parity ^= 1;
+		}
+		pos++;
+	}
+	if (syndrome != 0 && parity == 0)
+		return (-1);
+	if (parity)
+		*cw ^= (1 << syndrome);
+	*nibble = ((*cw >> 3) & 1) | (((*cw >> 5) & 1) << 1)
+		| (((*cw >> 6) & 1) << 2) | (((*cw >> 7) & 1) << 3);
+	return (parity);
+}
+
+/**
+ * @brief Encodes FEC_BLOCK_BYTES bytes into one interleaved 64-bit block.
+ */
+unsigned long long	fec_encode_block(const unsigned char *data)
+{
+	unsigned char		cw[FEC_BLOCK_CODEWORDS];
+	unsigned long long	stream;
+	int					t;
+
+	t = 0;
+	while (t < FEC_BLOCK_BYTES)
+	{
+		cw[2 * t] = secded_encode(data[t] >> 4);
+		cw[2 * t + 1] = secded_encode(data[t] & 0x0F);
+		t++;
+	}
+	stream = 0;
+	t = 0;
+	while (t < FEC_BLOCK_BITS)
+	{
+		stream = (stream << 1)
+			| ((cw[t % FEC_BLOCK_CODEWORDS] >> (t / FEC_BLOCK_CODEWORDS)) & 1);
+		t++;
+	}
+	return (stream);
+}
+
+/**
+ * @brief De-interleaves and decodes a complete 64-bit block.
+ * @return The number of corrected codewords, or -1 if any codeword was
+ * uncorrectable.
+ */
+int	fec_decode_block(unsigned long long stream, unsigned char *data)
+{
+	unsigned char	cw[FEC_BLOCK_CODEWORDS];
+	unsigned char	nibble[FEC_BLOCK_CODEWORDS];
+	int				corrected;
+	int				status;
+	int				t;
+
+	ft_bzero(cw, sizeof(cw));
+	t = 0;
+	while (t < FEC_BLOCK_BITS)
+	{
+		cw[t % FEC_BLOCK_CODEWORDS] |= ((stream >> (FEC_BLOCK_BITS - 1 - t)) & 1)
+			<< (t / FEC_BLOCK_CODEWORDS);
+		t++;
+	}
+	corrected = 0;
+	t = -1;
+	while (++t < FEC_BLOCK_CODEWORDS)
+	{
+		status = secded_decode(&cw[t], &nibble[t]);
+		if (status < 0)
+			return (-1);
+		corrected += status;
+	}
+	t = -1;
+	while (++t < FEC_BLOCK_BYTES)
+		data[t] = (nibble[2 * t] << 4) | nibble[2 * t + 1];
+	return (corrected);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fec_repair.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:10:45 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:10:45 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Inserts `bit` into the FEC_BLOCK_BITS - 1 bits of `partial` so
+ * that it becomes bit `pos` of the block, counted from the first sent.
+ */
+static unsigned long long	insert_bit(unsigned long long partial, int pos,
+		int bit)
+{
+	int	shift;
+
+	shift = FEC_BLOCK_BITS - 1 - pos;
+	return ((partial & ((1ULL << shift) - 1))
+		| ((((partial >> shift) << 1) | bit) << shift));
+}
+
+/**
+ * @brief Rebuilds a block that arrived one signal short.
+ *
+ * Standard signals are not queued: a signal sent while one of the same kind
+ * is still pending is simply dropped, so losses show up as deletions rather
+ * than flipped bits. A deletion shifts every later bit, which SECDED alone
+ * cannot fix. Every position and value of the missing bit is tried instead,
+ * and the candidate that decodes with the fewest corrections wins. A bit
+ * lost near the end of the block can leave a wrong guess that decodes just
+ * as cleanly, shifted by a nibble, so a tie between candidates holding
+ * different bytes is refused rather than guessed.
+ *
+ * @param partial The FEC_BLOCK_BITS - 1 bits received, first bit highest.
+ * @return Corrections needed by the chosen candidate, or -1 if none decodes
+ * or the best candidates disagree.
+ */
+int	fec_repair_block(unsigned long long partial, unsigned char *data)
+{
+	unsigned char	candidate[FEC_BLOCK_BYTES];
+	int				best;
+	int				tied;
+	int				status;
+	int				t;
+
+	partial &= (1ULL << (FEC_BLOCK_BITS - 1)) - 1;
+	best = -1;
+	tied = 0;
+	t = -1;
+	while (++t < 2 * FEC_BLOCK_BITS)
+	{
+		status = fec_decode_block(insert_bit(partial, t / 2, t & 1), candidate);
+		if (status >= 0 && (best < 0 || status < best))
+		{
+			best = status;
+			tied = 0;
+			ft_memcpy(data, candidate, FEC_BLOCK_BYTES);
+		}
+		else if (status >= 0 && status == best)
+			tied |= ft_memcmp(data, candidate, FEC_BLOCK_BYTES) != 0;
+	}
+	if (tied)
+		return (-1);
+	return (best);
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mt.c                                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:07:41 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:00:32 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include <errno.h>
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Opens a connection to the server `pid`. In a bonus build the ACK
+ * signals stay blocked while the connection is open.
+ * @return The connection, or NULL (errno set) if `pid` cannot be signalled.
+ */
+t_mt_conn	*mt_open(pid_t pid)
+{
+	t_mt_conn	*conn;
+
+	if (pid <= 0)
+		errno = EINVAL;
+	if (pid <= 0 || kill(pid, 0) == -1)
+		return (NULL);
+	conn = malloc(sizeof(*conn));
+	if (!conn)
+		return (NULL);
+	conn->pid = pid;
+	conn->frames = -1;
+	if (BONUSB && acks_hold() == -1)
+	{
+		free(conn);
+		return (NULL);
+	}
+	return (conn);
+}
+
+/**
+ * @brief Sends `len` bytes from `buf` as one message. In a bonus build the
+ * call returns once the server has acknowledged it, or within a session
+ * once it has acknowledged the latest PIPELINE_BATCH messages, and the
+ * receipt in the ACK has been checked.
+ * @return 0, or -1 with errno set: EINVAL when `buf` holds a byte that
+ * would end the message early (NUL, or PIPELINE_SEP within a session) or,
+ * outside a session, starts with PIPELINE_OPEN, or the error of kill() or
+ * of wait_ack() (ETIMEDOUT, EIO).
+ */
+int	mt_send(t_mt_conn *conn, const void *buf, size_t len)
+{
+	static const unsigned char	sep = PIPELINE_SEP;
+
+	if (!conn || (!buf && len) || (len && (ft_memchr(buf, '\0', len)
+				|| (conn->frames >= 0 && ft_memchr(buf, sep, len)))))
+	{
+		errno = EINVAL;
+		return (-1);
+	}
+	if (conn->frames < 0)
+	{
+		receipt_init(&conn->receipt, buf, len);
+		if (send_bytes(conn->pid, buf, len) == -1)
+			return (-1);
+		return (-(BONUSB && wait_ack(conn->pid, &conn->receipt, NULL) == -1));
+	}
+	receipt_add(&conn->receipt, buf, len);
+	receipt_add(&conn->receipt, &sep, 1);
+	if (send_raw(conn->pid, buf, len) == -1
+		|| send_raw(conn->pid, &sep, 1) == -1)
+		return (-1);
+	if (BONUSB && ++conn->frames % PIPELINE_BATCH == 0)
+		return (wait_ack(conn->pid, &conn->receipt, NULL));
+	return (0);
+}
+
+/**
+ * @brief Starts a pipelined session on `conn` (see mt_send()).
+ * @return 0, or -1 with errno set: ENOTSUP in FEC builds, EINVAL if a
+ * session is already open, or the error of kill().
+ */
+int	mt_session_begin(t_mt_conn *conn)
+{
+	static const unsigned char	start = PIPELINE_OPEN;
+
+	errno = EINVAL;
+	if (FECB)
+		errno = ENOTSUP;
+	if (FECB || !conn || conn->frames >= 0
+		|| send_raw(conn->pid, &start, 1) == -1)
+		return (-1);
+	conn->frames = 0;
+	receipt_init(&conn->receipt, &start, 1);
+	return (0);
+}
+
+/**
+ * @brief Ends the session open on `conn`. In a bonus build the call
+ * returns once the server has acknowledged the whole session.
+ * @return 0, or -1 with errno set (EINVAL when no session is open).
+ */
+int	mt_session_end(t_mt_conn *conn)
+{
+	static const unsigned char	end = '\0';
+
+	if (!conn || conn->frames < 0)
+	{
+		errno = EINVAL;
+		return (-1);
+	}
+	conn->frames = -1;
+	if (send_raw(conn->pid, &end, 1) == -1)
+		return (-1);
+	if (BONUSB)
+		return (wait_ack(conn->pid, &conn->receipt, NULL));
+	return (0);
+}
+
+/**
+ * @brief Closes a connection, ending its session if one is open.
+ */
+void	mt_close(t_mt_conn *conn)
+{
+	if (!conn)
+		return ;
+	if (conn->frames >= 0)
+		mt_session_end(conn);
+	free(conn);
+	if (BONUSB)
+		acks_release();
+}
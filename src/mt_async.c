@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mt_async.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:14:07 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:00:32 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include <errno.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Creates the timer of a loop, ticking every MT_TICK_US.
+ * @return The timerfd, or -1 with errno set.
+ */
+static int	open_timer(void)
+{
+	struct itimerspec	tick;
+	int					fd;
+
+	fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	ft_bzero(&tick, sizeof(tick));
+	tick.it_interval.tv_nsec = MT_TICK_US * 1000L;
+	tick.it_value = tick.it_interval;
+	if (fd != -1 && timerfd_settime(fd, 0, &tick, NULL) == -1)
+	{
+		close(fd);
+		fd = -1;
+	}
+	return (fd);
+}
+
+/**
+ * @brief Opens an async sender loop whose finished transfers are reported
+ * to `done` (may be NULL) along with `arg`. Its timer ticks every
+ * MT_TICK_US; in a bonus build it also reads the ACKs from a signalfd.
+ * @return The loop, or NULL with errno set.
+ */
+t_mt_loop	*mt_loop_open(t_mt_done done, void *arg)
+{
+	t_mt_loop	*loop;
+	sigset_t	set;
+
+	loop = ft_calloc(1, sizeof(*loop));
+	if (!loop)
+		return (NULL);
+	loop->done = done;
+	loop->arg = arg;
+	loop->signal_fd = -1;
+	loop->ack_ticks = ack_timeout_ms() * 1000L / MT_TICK_US;
+	loop->timer_fd = open_timer();
+	ack_set(&set);
+	if (BONUSB && acks_hold() == 0)
+	{
+		loop->signal_fd = signalfd(-1, &set, SFD_NONBLOCK | SFD_CLOEXEC);
+		if (loop->signal_fd == -1)
+			acks_release();
+	}
+	if (loop->timer_fd != -1 && (!BONUSB || loop->signal_fd != -1))
+		return (loop);
+	mt_loop_close(loop);
+	return (NULL);
+}
+
+static int	grow(t_mt_loop *loop)
+{
+	t_mt_xfer	*xfers;
+	size_t		cap;
+
+	cap = loop->cap * 2 + 16;
+	xfers = ft_realloc(loop->xfers, loop->cap * sizeof(t_mt_xfer),
+			cap * sizeof(t_mt_xfer));
+	if (!xfers)
+		return (-1);
+	loop->xfers = xfers;
+	loop->cap = cap;
+	return (0);
+}
+
+/**
+ * @brief Queues `len` bytes of `buf` (copied) as one message to `pid`. It
+ * starts once the transfers queued before it to the same server are over.
+ * Servers fed at the same pace ACK at the same moment; SIG_ACK is a
+ * real-time signal, so each of those ACKs is queued and read on its own.
+ * @return The id passed to `done` for this transfer, or -1 with errno
+ * set (EINVAL for a NUL byte in `buf` or a leading PIPELINE_OPEN,
+ * ECANCELED while closing).
+ */
+long	mt_send_async(t_mt_loop *loop, pid_t pid, const void *buf, size_t len)
+{
+	t_mt_xfer	*x;
+
+	errno = EINVAL;
+	if (loop && loop->closing)
+		errno = ECANCELED;
+	if (!loop || loop->closing || pid <= 0 || (!buf && len)
+		|| (len && (ft_memchr(buf, '\0', len)
+				|| *(const unsigned char *)buf == PIPELINE_OPEN)))
+		return (-1);
+	if (loop->count == loop->cap && grow(loop) == -1)
+		return (-1);
+	x = &loop->xfers[loop->count];
+	ft_bzero(x, sizeof(*x));
+	x->buf = ft_calloc(len + 1, 1);
+	if (!x->buf)
+		return (-1);
+	ft_memcpy(x->buf, buf, len);
+	x->id = loop->next_id++;
+	x->pid = pid;
+	x->len = len;
+	x->deadline = -1;
+	receipt_init(&x->receipt, x->buf, len);
+	x->resume = loop->now;
+	loop->count++;
+	return (x->id);
+}
+
+/**
+ * @brief Cancels the transfers still queued (`done` gets ECANCELED for
+ * each, in queue order) and frees the loop.
+ */
+void	mt_loop_close(t_mt_loop *loop)
+{
+	if (!loop)
+		return ;
+	loop->closing = 1;
+	while (loop->count > 0)
+		mt_finish(loop, 0, ECANCELED);
+	if (loop->timer_fd != -1)
+		close(loop->timer_fd);
+	if (loop->signal_fd != -1)
+	{
+		close(loop->signal_fd);
+		acks_release();
+	}
+	free(loop->xfers);
+	free(loop);
+}
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mt_async_ack.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:14:07 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:37:05 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include <errno.h>
+#include <sys/signalfd.h>
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Ends transfer `i`: removes it from the queue, keeping the order
+ * of the others, then reports `error` (0 on success) to `done`.
+ */
+void	mt_finish(t_mt_loop *loop, size_t i, int error)
+{
+	long	id;
+	pid_t	pid;
+
+	id = loop->xfers[i].id;
+	pid = loop->xfers[i].pid;
+	free(loop->xfers[i].buf);
+	loop->count--;
+	ft_memmove(loop->xfers + i, loop->xfers + i + 1,
+		(loop->count - i) * sizeof(t_mt_xfer));
+	if (loop->done)
+		loop->done(loop->arg, id, pid, error);
+}
+
+/**
+ * @brief (Bonus) Reads every ACK pending on the signalfd. An ACK ends the
+ * transfer in flight to its sender if that one is waiting for it, with EIO
+ * when its receipt shows the server got something else. ACKs that arrive
+ * while the transfer is still being sent are late ones, and dropped.
+ */
+void	mt_read_acks(t_mt_loop *loop)
+{
+	struct signalfd_siginfo	info;
+	size_t					i;
+
+	while (loop->signal_fd != -1
+		&& read(loop->signal_fd, &info, sizeof(info)) == sizeof(info))
+	{
+		i = 0;
+		while (i < loop->count && loop->xfers[i].pid != (pid_t)info.ssi_pid)
+			i++;
+		if (i < loop->count && loop->xfers[i].deadline >= 0)
+			mt_finish(loop, i,
+				EIO * (info.ssi_ptr != receipt_value(&loop->xfers[i].receipt)));
+	}
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mt_async_loop.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:14:07 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:37:05 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include <errno.h>
+#include <poll.h>
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Loads the next unit of `x` into `word`: a byte, or a SECDED block
+ * in a FEC build. The byte after the message is its NUL terminator.
+ * @return 1, or 0 once the terminator has been sent.
+ */
+static int	load_unit(t_mt_xfer *x)
+{
+	unsigned char	block[FEC_BLOCK_BYTES];
+	size_t			chunk;
+
+	if (x->pos > x->len)
+		return (0);
+	if (!FECB)
+	{
+		x->word = x->buf[x->pos++];
+		x->nbits = 8;
+		return (1);
+	}
+	chunk = x->len - x->pos;
+	if (chunk > FEC_BLOCK_BYTES)
+		chunk = FEC_BLOCK_BYTES;
+	ft_bzero(block, FEC_BLOCK_BYTES);
+	ft_memcpy(block, x->buf + x->pos, chunk);
+	x->word = fec_encode_block(block);
+	x->nbits = FEC_BLOCK_BITS;
+	x->pos += FEC_BLOCK_BYTES;
+	return (1);
+}
+
+/**
+ * @brief Sends the next bit of transfer `i`. From its last bit on, the
+ * transfer waits for the ACK (bonus build); otherwise it is over on the
+ * next tick, once a FEC block gap has passed.
+ * @return 1 if the transfer was removed from the queue, 0 otherwise.
+ */
+static int	send_next_bit(t_mt_loop *loop, size_t i)
+{
+	t_mt_xfer	*x;
+	int			sig;
+
+	x = &loop->xfers[i];
+	if (x->nbits == 0 && !load_unit(x))
+	{
+		mt_finish(loop, i, 0);
+		return (1);
+	}
+	x->nbits--;
+	sig = SIG_BIT_ZERO;
+	if ((x->word >> x->nbits) & 1)
+		sig = SIG_BIT_ONE;
+	if (FECB && x->nbits == 0)
+		x->resume = loop->now + FEC_BLOCK_GAP_US / MT_TICK_US;
+	if (kill(x->pid, sig) == -1)
+	{
+		mt_finish(loop, i, errno);
+		return (1);
+	}
+	if (BONUSB && x->nbits == 0 && x->pos > x->len)
+		x->deadline = loop->now + loop->ack_ticks;
+	return (0);
+}
+
+/**
+ * @brief Moves transfer `i` on by one tick, unless an earlier transfer to
+ * the same server is in flight. A transfer whose ACK is overdue is sent
+ * again from the start, up to MT_ASYNC_RETRIES times.
+ * @return 1 if the transfer was removed from the queue, 0 otherwise.
+ */
+static int	step_xfer(t_mt_loop *loop, size_t i)
+{
+	t_mt_xfer	*x;
+	size_t		j;
+
+	x = &loop->xfers[i];
+	j = 0;
+	while (j < i && loop->xfers[j].pid != x->pid)
+		j++;
+	if (j < i || loop->now < x->resume
+		|| (x->deadline >= 0 && loop->now < x->deadline))
+		return (0);
+	if (x->deadline >= 0 && x->retries++ == MT_ASYNC_RETRIES)
+	{
+		mt_finish(loop, i, ETIMEDOUT);
+		return (1);
+	}
+	if (x->deadline >= 0)
+	{
+		x->pos = 0;
+		x->deadline = -1;
+	}
+	return (send_next_bit(loop, i));
+}
+
+/**
+ * @brief Waits for the next event (a timer tick or ACKs) and handles it.
+ * Each tick sends one bit of every transfer in flight.
+ * @return 0, or -1 with errno set if poll() failed.
+ */
+int	mt_loop_step(t_mt_loop *loop)
+{
+	struct pollfd	fds[2];
+	uint64_t		ticks;
+	size_t			i;
+
+	if (loop->count == 0)
+		return (0);
+	fds[0].fd = loop->timer_fd;
+	fds[0].events = POLLIN;
+	fds[1].fd = loop->signal_fd;
+	fds[1].events = POLLIN;
+	if (poll(fds, 2, -1) == -1)
+		return (-(errno != EINTR));
+	mt_read_acks(loop);
+	if (read(loop->timer_fd, &ticks, sizeof(ticks)) != sizeof(ticks))
+		return (0);
+	loop->now += ticks;
+	i = 0;
+	while (i < loop->count)
+		i += !step_xfer(loop, i);
+	return (0);
+}
+
+/**
+ * @brief Runs the loop until every queued transfer is over.
+ * @return 0, or -1 with errno set if waiting for events failed.
+ */
+int	mt_loop_run(t_mt_loop *loop)
+{
+	while (loop->count > 0)
+	{
+		if (mt_loop_step(loop) == -1)
+			return (-1);
+	}
+	return (0);
+}
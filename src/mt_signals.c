@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mt_signals.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:08:12 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:37:05 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include <errno.h>
+#include "../includes/minitalk.h"
+
+static t_ack_holds	g_acks;
+
+/**
+ * @brief Fills `set` with the signals a server acknowledges with: SIG_ACK,
+ * or SIG_GROUP_ACK when the server belongs to a group (server -g).
+ */
+void	ack_set(sigset_t *set)
+{
+	sigemptyset(set);
+	sigaddset(set, SIG_ACK);
+	sigaddset(set, SIG_GROUP_ACK);
+}
+
+/**
+ * @brief Takes a hold on the ACK signals. The first hold blocks them and
+ * stores in `g_acks.blocked` those that were not blocked already.
+ */
+int	acks_hold(void)
+{
+	sigset_t	set;
+	sigset_t	old;
+
+	if (g_acks.holds++ > 0)
+		return (0);
+	ack_set(&set);
+	if (sigprocmask(SIG_BLOCK, &set, &old) == -1)
+	{
+		g_acks.holds--;
+		return (-1);
+	}
+	sigemptyset(&g_acks.blocked);
+	if (!sigismember(&old, SIG_ACK))
+		sigaddset(&g_acks.blocked, SIG_ACK);
+	if (!sigismember(&old, SIG_GROUP_ACK))
+		sigaddset(&g_acks.blocked, SIG_GROUP_ACK);
+	return (0);
+}
+
+/**
+ * @brief Waits until ack_timeout_ms() has passed for the ACK of `pid`,
+ * then checks its receipt against `sent`. ACKs from other servers are
+ * dropped on the way. `got` (may be NULL) receives the server's receipt.
+ * @return 0, or -1 with errno set to ETIMEDOUT, or to EIO when the server
+ * did not receive what was sent.
+ */
+int	wait_ack(pid_t pid, const t_receipt *sent, uint64_t *got)
+{
+	sigset_t		set;
+	siginfo_t		info;
+	struct timespec	deadline;
+	struct timespec	left;
+	int				sig;
+
+	ack_set(&set);
+	ack_deadline(&deadline);
+	sig = -1;
+	while (sig == -1 && ack_time_left(&deadline, &left))
+	{
+		sig = sigtimedwait(&set, &info, &left);
+		if (sig != -1 && info.si_pid != pid)
+			sig = -1;
+	}
+	errno = ETIMEDOUT;
+	if (sig != -1 && got)
+		*got = receipt_received(&info);
+	if (sig != -1 && receipt_received(&info) == receipt_value(sent))
+		return (0);
+	if (sig != -1)
+		errno = EIO;
+	return (-1);
+}
+
+/**
+ * @brief Drops a hold on the ACK signals. The last one drops any ACK still
+ * pending, so unblocking it cannot kill the process, then unblocks the
+ * signals the first hold blocked.
+ */
+void	acks_release(void)
+{
+	sigset_t		set;
+	struct timespec	zero;
+
+	if (--g_acks.holds > 0)
+		return ;
+	ack_set(&set);
+	zero.tv_sec = 0;
+	zero.tv_nsec = 0;
+	while (sigtimedwait(&set, NULL, &zero) != -1)
+		;
+	sigprocmask(SIG_UNBLOCK, &g_acks.blocked, NULL);
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   receipt.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:29:41 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:29:41 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Starts the receipt of a message with its first `len` bytes.
+ */
+void	receipt_init(t_receipt *receipt, const void *buf, size_t len)
+{
+	receipt->len = 0;
+	receipt->crc = 0;
+	receipt_add(receipt, buf, len);
+}
+
+/**
+ * @brief Adds `len` more bytes of the message to its receipt.
+ */
+void	receipt_add(t_receipt *receipt, const void *buf, size_t len)
+{
+	if (len == 0)
+		return ;
+	receipt->len += len;
+	receipt->crc = ft_crc32(receipt->crc, buf, len);
+}
+
+/**
+ * @brief Packs a receipt into the payload of an ACK: the length in the
+ * high 32 bits, the CRC in the low ones. The payload travels as a pointer
+ * (sival_ptr), so where pointers have 32 bits only the CRC is kept; the
+ * value is cut the same way on both ends, so they still compare equal.
+ */
+uint64_t	receipt_value(const t_receipt *receipt)
+{
+	return ((uintptr_t)((uint64_t)receipt->len << 32 | receipt->crc));
+}
+
+/**
+ * @brief The receipt a server sent in an ACK, as given by sigtimedwait().
+ */
+uint64_t	receipt_received(const siginfo_t *info)
+{
+	return ((uintptr_t)info->si_value.sival_ptr);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   registry.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:34 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:56:41 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minitalk.h"
+#include "../libft/includes/ft_hash.h"
+
+/**
+ * @brief Directory of the server registry: $MINITALK_REGISTRY if set,
+ * REGISTRY_DIR otherwise.
+ */
+const char	*registry_dir(void)
+{
+	const char	*dir;
+
+	dir = getenv("MINITALK_REGISTRY");
+	if (!dir || !*dir)
+		dir = REGISTRY_DIR;
+	return (dir);
+}
+
+/**
+ * @brief Builds the path of the registry entry `name` (a server PID) into
+ * `path`, which holds REGISTRY_PATH_MAX bytes.
+ * @return SUCCESS, or FAILURE if the path does not fit.
+ */
+int	registry_path(char *path, const char *name)
+{
+	if (ft_snprintf(path, REGISTRY_PATH_MAX, "%s/%s", registry_dir(), name)
+		>= REGISTRY_PATH_MAX)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @brief Position of `x` on the 32-bit hash ring: the high half of libft's
+ * splitmix64 finalizer.
+ */
+uint32_t	ring_hash(uint64_t x)
+{
+	return (ft_hash_mix(x) >> 32);
+}
+
+/**
+ * @brief Distance, clockwise on the ring, from a key to the nearest of the
+ * REGISTRY_VNODES points of server `pid`. The server with the smallest
+ * distance owns the key, so adding or removing a server only moves the
+ * keys that fall between its points and their predecessors, about 1/n of
+ * them.
+ */
+uint32_t	ring_distance(pid_t pid, uint32_t key_hash)
+{
+	uint32_t	best;
+	uint32_t	distance;
+	int			vnode;
+
+	best = UINT32_MAX;
+	vnode = 0;
+	while (vnode < REGISTRY_VNODES)
+	{
+		distance = ring_hash((uint64_t)(uint32_t)pid << 32 | vnode) - key_hash;
+		if (distance < best)
+			best = distance;
+		vnode++;
+	}
+	return (best);
+}
@@ -6,7 +6,7 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/03 14:45:38 by fyudris           #+#    #+#             */
-/*   Updated: 2025/06/05 20:28:40 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 14:48:56 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,9 +19,11 @@
  * The Minitalk server communicates asynchronouly using signals.
  * Signal handlers have a restricted signature and cannot easily be passed
  * arbitrary context. To maintain the state of message reception across
- * multiple signal invocations (e.g., tracking the current client, the partially
- * built character, and the dynamically accumulating message string), a
- * persistent state accessible to the signal handler is necessary.
+ * multiple signal invocations (e.g., tracking the current client and the
+ * partially built character), a persistent state accessible to the signal
+ * handler is necessary. The accumulating message string and its receipt are
+ * kept apart, in server_text(), since they are never accessed outside the
+ * handler with the transport signals unblocked.
  *
  * A single static global struct `g_state` encapsulates all this communication
  * state.
@@ -36,27 +38,34 @@
 volatile t_server_state	g_state;
 
 /**
- * @brief Handles a fully received byte.
+ * @brief Handles a fully received byte. Framing bytes of a pipelined
+ * session are handled by pipeline_byte(); a session only prints and counts
+ * its messages there, its NUL just acknowledges and resets.
  */
-static void	handle_completed_byte(void)
+void	handle_completed_byte(void)
 {
-	if (g_state.char_in_progress == '\0')
+	unsigned char	c;
+
+	c = g_state.char_in_progress;
+	g_state.char_in_progress = 0;
+	g_state.bits_received = 0;
+	receipt_add(&server_text()->receipt, &c, c != '\0');
+	if (pipeline_byte(c))
+		return ;
+	if (c != '\0')
 	{
-		if (g_state.message_buffer)
-			write(FD_STDOUT, g_state.message_buffer, g_state.message_len);
-		write(FD_STDOUT, "\n", 1);
-		if (BONUSB && g_state.active_client_pid != 0)
-			if (kill(g_state.active_client_pid, SIG_ACK) == -1)
-				ft_putstr_fd("Server: Failed to send ACK.\n", FD_STDERR);
-		init_server_state(0);
+		if (append_char_to_buffer(c) == FAILURE)
+			init_server_state(g_state.active_client_pid);
+		return ;
 	}
-	else
+	if (!g_state.pipelined)
 	{
-		if (append_char_to_buffer(g_state.char_in_progress) == FAILURE)
-			init_server_state(g_state.active_client_pid);
+		server_print_message(&server_text()->message);
+		registry_update(0, 1);
 	}
-	g_state.char_in_progress = 0;
-	g_state.bits_received = 0;
+	if (BONUSB && g_state.active_client_pid != 0)
+		server_send_ack(g_state.active_client_pid, &server_text()->receipt);
+	init_server_state(0);
 }
 
 /**
@@ -68,9 +77,16 @@ static void	server_signal_handler(int sig, siginfo_t *info, void *ucontext)
 	if (g_state.active_client_pid == 0
 		|| (info->si_pid != 0 && g_state.active_client_pid != info->si_pid))
 	{
+		if (FECB && g_state.active_client_pid != 0)
+			fec_flush_stale(0);
 		if (init_server_state(info->si_pid) == FAILURE)
 			return ;
 	}
+	if (FECB)
+	{
+		fec_receive_bit(sig == SIG_BIT_ONE);
+		return ;
+	}
 	if (sig == SIG_BIT_ONE)
 		g_state.char_in_progress |= (1 << (7 - g_state.bits_received));
 	g_state.bits_received++;
@@ -90,9 +106,11 @@ static int	setup_signal_handlers(void)
 
 	sa_config.sa_sigaction = server_signal_handler;
 	sa_config.sa_flags = SA_SIGINFO | SA_RESTART;
-	if (sigemptyset(&sa_config.sa_mask) == -1)
+	if (sigemptyset(&sa_config.sa_mask) == -1
+		|| sigaddset(&sa_config.sa_mask, SIG_BIT_ONE) == -1
+		|| sigaddset(&sa_config.sa_mask, SIG_BIT_ZERO) == -1)
 	{
-		ft_putstr_fd("Error: sigemptyset failed.\n", FD_STDERR);
+		ft_putstr_fd("Error: signal mask setup failed.\n", FD_STDERR);
 		return (FAILURE);
 	}
 	if (sigaction(SIG_BIT_ONE, &sa_config, NULL) == -1
@@ -105,27 +123,56 @@ static int	setup_signal_handlers(void)
 }
 
 /**
- * @brief Main function for the Minitalk server.
+ * @brief Runs the classic single-threaded server: signals are decoded by
+ * server_signal_handler() while the main loop sleeps.
  */
-int	main(void)
+static int	run_server(void)
 {
-	ft_printf("Server PID: %d\n", getpid());
 	if (init_server_state(0) == FAILURE)
 		return (FAILURE);
 	if (setup_signal_handlers() == FAILURE)
 	{
-		if (g_state.message_buffer)
-			free(g_state.message_buffer);
+		ft_sb_free(&server_text()->message);
 		return (FAILURE);
 	}
 	ft_printf("Server ready. Waiting for signals...\n");
 	while (1)
-		pause();
-	if (g_state.message_buffer)
-		free(g_state.message_buffer);
+	{
+		if (FECB)
+		{
+			usleep(FEC_GAP_US);
+			fec_flush_stale(FEC_IDLE_US);
+		}
+		else
+			pause();
+	}
+	ft_sb_free(&server_text()->message);
 	return (SUCCESS);
 }
 
+/**
+ * @brief Main function for the Minitalk server.
+ * `server -t <workers>` runs the threaded server instead,
+ * `server -g <pgid>` joins a broadcast group first and `server -r` adds the
+ * server to the registry clients pick servers from.
+ */
+int	main(int argc, char **argv)
+{
+	t_server_opts	opts;
+
+	if (parse_server_args(argc, argv, &opts) == FAILURE)
+		return (FAILURE);
+	g_state.ack_signal = SIG_ACK;
+	g_state.registry_fd = -1;
+	ft_printf("Server PID: %d\n", getpid());
+	if ((opts.grouped && join_server_group(opts.group) == FAILURE)
+		|| (opts.registered && registry_open() == FAILURE))
+		return (FAILURE);
+	if (opts.workers > 0)
+		return (run_threaded_server(opts.workers));
+	return (run_server());
+}
+
 // /**
 //  * @brief    Checks if the signal is SIGUSR1. If it is, it will
 //  * assign 1 to the LSB. Else, it will assign 0 (actually it simply
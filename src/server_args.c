@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_args.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:55:01 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:05:33 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Reads a non-negative decimal option value.
+ * @return The value, or -1 if `s` is not 1 to 9 digits.
+ */
+static long	parse_number(const char *s)
+{
+	int	digits;
+
+	digits = 0;
+	while (ft_isdigit(s[digits]))
+		digits++;
+	if (digits == 0 || digits > 9 || s[digits] != '\0')
+		return (-1);
+	return (ft_atol(s));
+}
+
+/**
+ * @brief Turns the `-t` value into a worker count: 0 means one per online
+ * core, and the result is capped at SERVER_MAX_WORKERS.
+ */
+static int	worker_count(long requested)
+{
+	if (requested == 0)
+		requested = sysconf(_SC_NPROCESSORS_ONLN);
+	if (requested < 1)
+		requested = 1;
+	if (requested > SERVER_MAX_WORKERS)
+		requested = SERVER_MAX_WORKERS;
+	return (requested);
+}
+
+/**
+ * @brief Applies one option: -t starts the threaded server (see
+ * server_threads.c), -g joins the broadcast group `value`, 0 making a new
+ * one.
+ * @return SUCCESS, or FAILURE for an unknown flag or a bad value.
+ */
+static int	set_option(t_server_opts *opts, const char *flag, long value)
+{
+	if (FECB && ft_strncmp(flag, "-t", 3) == 0)
+	{
+		ft_putstr_fd("Error: -t is not available in the fec build.\n",
+			FD_STDERR);
+		return (FAILURE);
+	}
+	if (value < 0)
+		return (FAILURE);
+	if (ft_strncmp(flag, "-t", 3) == 0)
+		opts->workers = worker_count(value);
+	else if (ft_strncmp(flag, "-g", 3) == 0)
+	{
+		opts->grouped = 1;
+		opts->group = value;
+	}
+	else
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @brief Parses `[-t <workers>] [-g <pgid>] [-r]`; -r (no value) registers
+ * the server (see server_registry.c).
+ * @return SUCCESS or FAILURE (usage printed).
+ */
+int	parse_server_args(int argc, char **argv, t_server_opts *opts)
+{
+	long	value;
+	int		i;
+
+	ft_bzero(opts, sizeof(*opts));
+	i = 1;
+	while (i < argc)
+	{
+		value = -1;
+		if (i + 1 < argc)
+			value = parse_number(argv[i + 1]);
+		if (ft_strncmp(argv[i], "-r", 3) == 0)
+			opts->registered = 1;
+		else if (set_option(opts, argv[i], value) == FAILURE)
+		{
+			ft_dprintf(FD_STDERR, "Usage: %s [-t <workers>] [-g <pgid>] "
+				"[-r]\n", argv[0]);
+			return (FAILURE);
+		}
+		i += 1 + (ft_strncmp(argv[i], "-r", 3) != 0);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Moves the server into the broadcast group `pgid` (a new group led
+ * by the server when `pgid` is 0). Every kill(-pgid, ...) then reaches all
+ * members at once. Members acknowledge with the queued SIG_GROUP_ACK, so
+ * a client can count the ACKs of all of them.
+ * @return SUCCESS or FAILURE.
+ */
+int	join_server_group(pid_t pgid)
+{
+	if (setpgid(0, pgid) == -1)
+	{
+		ft_dprintf(FD_STDERR, "Error: cannot join process group %d.\n", pgid);
+		return (FAILURE);
+	}
+	g_state.ack_signal = SIG_GROUP_ACK;
+	ft_printf("Server group: %d\n", getpgrp());
+	return (SUCCESS);
+}
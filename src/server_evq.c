@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_evq.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:52:23 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:52:23 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include <errno.h>
+#include "../includes/minitalk.h"
+
+/**
+ * @brief (Dispatcher) Queues one event for a worker and wakes it if it
+ * is asleep. A full queue is waited out, never dropped.
+ */
+void	evq_push(t_evqueue *queue, uint64_t event)
+{
+	size_t	tail;
+
+	tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+	while (tail - atomic_load_explicit(&queue->head, memory_order_acquire)
+		== EVENT_QUEUE_SIZE)
+		sched_yield();
+	queue->events[tail & (EVENT_QUEUE_SIZE - 1)] = event;
+	atomic_store(&queue->tail, tail + 1);
+	if (atomic_exchange(&queue->sleeping, 0))
+		sem_post(&queue->wake);
+}
+
+/**
+ * @brief (Worker) Blocks on the queue's semaphore, for at most
+ * SESSION_IDLE_MS when `timed`.
+ * @return 1 when woken, 0 when the time ran out.
+ */
+static int	evq_sleep(t_evqueue *queue, int timed)
+{
+	struct timespec	deadline;
+
+	if (!timed)
+	{
+		while (sem_wait(&queue->wake) == -1)
+			;
+		return (1);
+	}
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	deadline.tv_nsec += (SESSION_IDLE_MS % 1000) * 1000000L;
+	deadline.tv_sec += SESSION_IDLE_MS / 1000 + deadline.tv_nsec / 1000000000L;
+	deadline.tv_nsec %= 1000000000L;
+	while (sem_timedwait(&queue->wake, &deadline) == -1)
+	{
+		if (errno == ETIMEDOUT)
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief (Worker) Takes the next event, sleeping while the queue is empty.
+ * `sleeping` is raised before the last look at `tail`, and the dispatcher
+ * publishes `tail` before it looks at `sleeping`, so either the worker sees
+ * the new event or the dispatcher sees the flag and posts the semaphore.
+ * A post left over from a timed-out sleep only costs one extra look.
+ * @param timed Give up after SESSION_IDLE_MS without events.
+ * @return 1 with the event in `*event`, or 0 if the wait timed out.
+ */
+int	evq_pop(t_evqueue *queue, uint64_t *event, int timed)
+{
+	size_t	head;
+	int		woken;
+
+	head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+	while (head == atomic_load_explicit(&queue->tail, memory_order_acquire))
+	{
+		atomic_store(&queue->sleeping, 1);
+		woken = 1;
+		if (head == atomic_load(&queue->tail))
+			woken = evq_sleep(queue, timed);
+		atomic_store(&queue->sleeping, 0);
+		if (!woken)
+			return (0);
+	}
+	*event = queue->events[head & (EVENT_QUEUE_SIZE - 1)];
+	atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+	return (1);
+}
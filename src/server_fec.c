@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_fec.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:30:31 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 12:30:31 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <time.h>
+#include "../includes/minitalk.h"
+
+static long	monotonic_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000L + ts.tv_nsec / 1000L);
+}
+
+/**
+ * @brief Feeds the decoded bytes of one block into the normal byte path.
+ * Bytes after the terminating NUL are block padding and are skipped. While a
+ * message is being dropped (an earlier block was unrecoverable) its bytes are
+ * discarded until its terminator shows up.
+ */
+static void	deliver_block(const unsigned char *data)
+{
+	int	i;
+
+	i = 0;
+	while (i < FEC_BLOCK_BYTES)
+	{
+		if (g_state.fec_dropping && data[i] == '\0')
+		{
+			ft_putstr_fd("Server: Dropped message with an unrecoverable "
+				"FEC block.\n", FD_STDERR);
+			init_server_state(0);
+			return ;
+		}
+		if (!g_state.fec_dropping)
+		{
+			g_state.char_in_progress = data[i];
+			handle_completed_byte();
+			if (data[i] == '\0')
+				return ;
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Decodes a full block that had a silence after bit `gap_at`.
+ *
+ * A silence after 63 bits is either a stalled last signal (the block is fine)
+ * or the client's block pause after a lost signal (the 64th bit already
+ * belongs to the next block). Both readings are decoded and the one needing
+ * fewer corrections wins. For any other silence, the bits before it were the
+ * tail of an earlier block that lost several signals: they are discarded.
+ *
+ * @return Bits to carry over into the next block, or -1 if the bits before
+ * the silence were discarded and the block is still being collected.
+ */
+static int	decode_with_gap(unsigned char *data, int *status)
+{
+	unsigned char	repaired[FEC_BLOCK_BYTES];
+	int				repair_status;
+
+	*status = fec_decode_block(g_state.fec_stream, data);
+	if (*status == 0 || g_state.fec_gap_at == 0)
+		return (0);
+	if (g_state.fec_gap_at == FEC_BLOCK_BITS - 1)
+	{
+		repair_status = fec_repair_block(g_state.fec_stream >> 1, repaired);
+		if (repair_status < 0 || (*status >= 0 && *status <= repair_status))
+			return (0);
+		*status = repair_status;
+		ft_memcpy(data, repaired, FEC_BLOCK_BYTES);
+		return (1);
+	}
+	if (*status >= 0)
+		return (0);
+	g_state.fec_bits = FEC_BLOCK_BITS - g_state.fec_gap_at;
+	g_state.fec_stream &= (1ULL << g_state.fec_bits) - 1;
+	g_state.fec_gap_at = 0;
+	g_state.fec_dropping = 1;
+	return (-1);
+}
+
+/**
+ * @brief Decodes the block collected so far, repairing a single missing
+ * signal if the block came up one short, and hands the bytes on.
+ */
+static void	close_block(void)
+{
+	unsigned char	data[FEC_BLOCK_BYTES];
+	int				status;
+	int				carry;
+
+	status = -1;
+	carry = 0;
+	if (g_state.fec_bits == FEC_BLOCK_BITS)
+		carry = decode_with_gap(data, &status);
+	else if (g_state.fec_bits == FEC_BLOCK_BITS - 1)
+		status = fec_repair_block(g_state.fec_stream, data);
+	if (carry < 0)
+		return ;
+	g_state.fec_stream &= (1ULL << carry) - 1;
+	g_state.fec_bits = carry;
+	g_state.fec_gap_at = 0;
+	if (status >= 0)
+		deliver_block(data);
+	else
+		g_state.fec_dropping = 1;
+}
+
+/**
+ * @brief Adds one received signal to the current FEC block.
+ * Blocks are delimited by their length; silences on the line are only
+ * remembered (see decode_with_gap), since the client pauses after every
+ * block but scheduling hiccups can stall the line mid-block too.
+ */
+void	fec_receive_bit(int bit)
+{
+	long	now;
+
+	now = monotonic_us();
+	if (g_state.fec_bits > 0 && now - g_state.fec_last_us > FEC_GAP_US)
+		g_state.fec_gap_at = g_state.fec_bits;
+	g_state.fec_stream = (g_state.fec_stream << 1) | (bit != 0);
+	g_state.fec_bits++;
+	g_state.fec_last_us = now;
+	if (g_state.fec_bits == FEC_BLOCK_BITS)
+		close_block();
+}
+
+/**
+ * @brief Closes a partial block once the line has been idle for `idle_us`.
+ * The main loop calls this with FEC_IDLE_US to finish a message whose last
+ * block came up short; the signal handler calls it with 0 before switching
+ * to another client. The transport signals are blocked meanwhile.
+ */
+void	fec_flush_stale(long idle_us)
+{
+	sigset_t	block;
+	sigset_t	saved;
+
+	sigemptyset(&block);
+	sigaddset(&block, SIG_BIT_ONE);
+	sigaddset(&block, SIG_BIT_ZERO);
+	sigprocmask(SIG_BLOCK, &block, &saved);
+	if (g_state.fec_bits > 0
+		&& monotonic_us() - g_state.fec_last_us >= idle_us)
+		close_block();
+	sigprocmask(SIG_SETMASK, &saved, NULL);
+}
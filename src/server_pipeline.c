@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_pipeline.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:21:43 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:48:56 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Handles the framing bytes of a pipelined session for the classic
+ * server. A PIPELINE_OPEN first byte opens the session; then every
+ * PIPELINE_SEP prints one message and empties the builder, which keeps its
+ * storage and its client, so the next message starts warm. The session's
+ * NUL prints a last unterminated message, if any, then ends it as usual.
+ * @return 1 if the byte was consumed here, 0 if the normal path takes it.
+ */
+int	pipeline_byte(unsigned char c)
+{
+	t_strbuf	*message;
+
+	message = &server_text()->message;
+	if (c == PIPELINE_OPEN && !g_state.pipelined && message->len == 0)
+	{
+		g_state.pipelined = 1;
+		return (1);
+	}
+	if (!g_state.pipelined
+		|| (c != PIPELINE_SEP && (c != '\0' || message->len == 0)))
+		return (0);
+	server_print_message(message);
+	registry_update(0, 1);
+	ft_sb_clear(message);
+	if (BONUSB && c == PIPELINE_SEP
+		&& ++g_state.pipeline_count % PIPELINE_BATCH == 0)
+		server_send_ack(g_state.active_client_pid, &server_text()->receipt);
+	return (c == PIPELINE_SEP);
+}
+
+/**
+ * @brief Threaded counterpart of pipeline_byte(), on one client session.
+ * @return 1 if the byte was consumed here, 0 if the normal path takes it.
+ */
+int	session_pipeline_byte(t_worker *worker, t_session *session,
+		unsigned char c)
+{
+	if (c == PIPELINE_OPEN && !session->pipelined
+		&& session->message.len == 0)
+	{
+		session->pipelined = 1;
+		return (1);
+	}
+	if (!session->pipelined
+		|| (c != PIPELINE_SEP && (c != '\0' || session->message.len == 0)))
+		return (0);
+	pthread_mutex_lock(worker->out_lock);
+	server_print_message(&session->message);
+	pthread_mutex_unlock(worker->out_lock);
+	registry_update(0, 1);
+	ft_sb_clear(&session->message);
+	if (BONUSB && c == PIPELINE_SEP
+		&& ++session->frames % PIPELINE_BATCH == 0)
+		server_send_ack(session->pid, &session->receipt);
+	return (c == PIPELINE_SEP);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_registry.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:45 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:56:41 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Writes `n` right-aligned into a REGISTRY_FIELD-wide field.
+ * Uses no allocation, as it runs inside the signal handler.
+ */
+static void	put_field(char *field, long n)
+{
+	char	digits[FT_FMT_BUFSIZE];
+	size_t	len;
+
+	if (n < 0)
+		n = 0;
+	len = ft_fmt_u64(digits, n);
+	if (len > REGISTRY_FIELD)
+		len = REGISTRY_FIELD;
+	ft_memset(field, ' ', REGISTRY_FIELD - len);
+	ft_memcpy(field + REGISTRY_FIELD - len, digits, len);
+}
+
+/**
+ * @brief Publishes the load figure of a registered server: the number of
+ * messages being received right now and the number received so far.
+ * The record has a fixed width and is rewritten in place with a single
+ * pwrite(), so readers never see a torn or shorter record. Safe to call
+ * from the signal handler and from several workers at once.
+ * @param busy_delta Change of the number of messages in progress.
+ * @param done_delta Change of the number of messages received.
+ */
+void	registry_update(int busy_delta, int done_delta)
+{
+	char	record[REGISTRY_RECORD];
+
+	if (g_state.registry_fd < 0)
+		return ;
+	put_field(record, atomic_fetch_add(&g_state.registry_busy, busy_delta)
+		+ busy_delta);
+	record[REGISTRY_FIELD] = ' ';
+	put_field(record + REGISTRY_FIELD + 1,
+		atomic_fetch_add(&g_state.registry_done, done_delta) + done_delta);
+	record[REGISTRY_RECORD - 1] = '\n';
+	pwrite(g_state.registry_fd, record, REGISTRY_RECORD, 0);
+}
+
+/**
+ * @brief Removes the registry entry when the server is stopped with
+ * SIGINT or SIGTERM. Entries of servers that die otherwise lose their lock
+ * and are removed by the clients that find them (see client_registry.c).
+ */
+static void	registry_on_exit(int sig)
+{
+	(void)sig;
+	unlink((const char *)g_state.registry_path);
+	_exit(SUCCESS);
+}
+
+/**
+ * @brief Creates the entry under the hidden name .<pid>, takes the
+ * exclusive flock() that marks it live for the server's whole life, fills
+ * in the record and only then renames it to `path`. Clients therefore
+ * never see the entry of a running server unlocked, and a stale entry left
+ * under the same PID is replaced in one step.
+ * @return SUCCESS or FAILURE.
+ */
+static int	registry_publish(const char *path)
+{
+	char	hidden[REGISTRY_PATH_MAX];
+	char	name[16];
+
+	ft_snprintf(name, sizeof(name), ".%d", getpid());
+	if (registry_path(hidden, name) == FAILURE)
+		return (FAILURE);
+	g_state.registry_fd = open(hidden, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (g_state.registry_fd < 0)
+		return (FAILURE);
+	if (flock(g_state.registry_fd, LOCK_EX | LOCK_NB) == 0)
+	{
+		registry_update(0, 0);
+		if (rename(hidden, path) == 0)
+			return (SUCCESS);
+	}
+	unlink(hidden);
+	close(g_state.registry_fd);
+	g_state.registry_fd = -1;
+	return (FAILURE);
+}
+
+/**
+ * @brief Registers the server: publishes <registry>/<pid> holding its load
+ * figure, which clients read to pick a server (client -k / -l).
+ * @return SUCCESS or FAILURE.
+ */
+int	registry_open(void)
+{
+	struct sigaction	sa_exit;
+	char				pid[16];
+
+	ft_snprintf(pid, sizeof(pid), "%d", getpid());
+	if ((mkdir(registry_dir(), 01777) == -1 && errno != EEXIST)
+		|| registry_path((char *)g_state.registry_path, pid) == FAILURE
+		|| registry_publish((const char *)g_state.registry_path) == FAILURE)
+	{
+		ft_dprintf(FD_STDERR, "Error: cannot register in %s.\n",
+			registry_dir());
+		return (FAILURE);
+	}
+	sa_exit.sa_handler = registry_on_exit;
+	sa_exit.sa_flags = 0;
+	sigemptyset(&sa_exit.sa_mask);
+	sigaction(SIGINT, &sa_exit, NULL);
+	sigaction(SIGTERM, &sa_exit, NULL);
+	ft_printf("Server registered in %s\n", registry_dir());
+	return (SUCCESS);
+}
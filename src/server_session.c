@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_session.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:50:36 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:54:36 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Starts the session of a client on its first bit and puts it at
+ * the head of the worker's live list.
+ * @return The session, or NULL if memory could not be allocated.
+ */
+static t_session	*session_new(t_worker *worker, pid_t pid)
+{
+	t_session	*session;
+
+	session = ft_calloc(1, sizeof(t_session));
+	if (!session)
+		return (NULL);
+	session->pid = pid;
+	receipt_init(&session->receipt, NULL, 0);
+	ft_sb_init(&session->message);
+	if (ft_hmap_put(&worker->sessions, (uint32_t)pid, session) == -1)
+	{
+		free(session);
+		return (NULL);
+	}
+	session->next = worker->live;
+	if (worker->live)
+		worker->live->prev = session;
+	worker->live = session;
+	registry_update(1, 0);
+	return (session);
+}
+
+/**
+ * @brief Finds the session of a client, starting one on its first bit,
+ * and stamps it with the time of this bit. A session silent for more than
+ * SESSION_IDLE_MS belonged to a client that died or lost bits, maybe under
+ * a PID now reused: it is dropped, and the bit starts a new one.
+ * @return The session, or NULL if memory could not be allocated.
+ */
+static t_session	*session_get(t_worker *worker, pid_t pid)
+{
+	t_session	*session;
+	void		**slot;
+	long		now;
+
+	now = session_clock_ms();
+	slot = ft_hmap_get(&worker->sessions, (uint32_t)pid);
+	session = NULL;
+	if (slot)
+		session = *slot;
+	if (session && now - session->last_ms >= SESSION_IDLE_MS)
+	{
+		session_drop(worker, session);
+		session = NULL;
+	}
+	if (!session)
+		session = session_new(worker, pid);
+	if (session)
+		session->last_ms = now;
+	return (session);
+}
+
+/**
+ * @brief Forgets a session: takes it out of the map and the live list and
+ * frees it.
+ */
+void	session_free(t_worker *worker, t_session *session)
+{
+	ft_hmap_del(&worker->sessions, (uint32_t)session->pid, NULL);
+	if (session->prev)
+		session->prev->next = session->next;
+	else
+		worker->live = session->next;
+	if (session->next)
+		session->next->prev = session->prev;
+	ft_sb_free(&session->message);
+	free(session);
+}
+
+/**
+ * @brief Prints a finished message and forgets the session (a pipelined
+ * one has printed its messages already).
+ * Workers share stdout, so printing is serialized by `out_lock`; a long
+ * message can take several write() calls and must not be interleaved.
+ */
+static void	session_end(t_worker *worker, t_session *session)
+{
+	if (!session->pipelined)
+	{
+		pthread_mutex_lock(worker->out_lock);
+		server_print_message(&session->message);
+		pthread_mutex_unlock(worker->out_lock);
+	}
+	registry_update(-1, !session->pipelined);
+	if (BONUSB && session->pid != 0)
+		server_send_ack(session->pid, &session->receipt);
+	session_free(worker, session);
+}
+
+/**
+ * @brief Threaded counterpart of the signal handler: adds one bit to the
+ * message of `pid`. Every client has its own session, so clients talking
+ * to different workers no longer reset each other.
+ * @param worker The worker owning the sessions of `pid`.
+ * @param pid The sender of the signal.
+ * @param bit 1 for SIG_BIT_ONE, 0 for SIG_BIT_ZERO.
+ */
+void	session_receive_bit(t_worker *worker, pid_t pid, int bit)
+{
+	t_session		*session;
+	unsigned char	c;
+
+	session = session_get(worker, pid);
+	if (!session)
+	{
+		ft_putstr_fd("Error: Server malloc failed.\n", FD_STDERR);
+		return ;
+	}
+	session->char_in_progress |= (bit << (7 - session->bits_received));
+	if (++session->bits_received < 8)
+		return ;
+	c = session->char_in_progress;
+	session->char_in_progress = 0;
+	session->bits_received = 0;
+	receipt_add(&session->receipt, &c, c != '\0');
+	if (session_pipeline_byte(worker, session, c))
+		return ;
+	if (c == '\0')
+		session_end(worker, session);
+	else if (ft_sb_append_char(&session->message, c) == -1)
+	{
+		ft_putstr_fd("Error: Server malloc failed.\n", FD_STDERR);
+		ft_sb_clear(&session->message);
+	}
+}
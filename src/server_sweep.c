@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_sweep.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:52:57 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:52:57 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Monotonic time in milliseconds, for the idle stamps of sessions.
+ */
+long	session_clock_ms(void)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1000L + now.tv_nsec / 1000000L);
+}
+
+/**
+ * @brief Drops a session that went silent before its NUL: its client died,
+ * or lost bits to coalescing and waits for an ACK that will not come. The
+ * partial message is discarded with a note on stderr.
+ */
+void	session_drop(t_worker *worker, t_session *session)
+{
+	pthread_mutex_lock(worker->out_lock);
+	ft_dprintf(FD_STDERR, "Server: dropped the unfinished message of %d "
+		"(silent for %d ms).\n", session->pid, SESSION_IDLE_MS);
+	pthread_mutex_unlock(worker->out_lock);
+	registry_update(-1, 0);
+	session_free(worker, session);
+}
+
+/**
+ * @brief Drops every session of the worker silent for SESSION_IDLE_MS.
+ * Runs when the worker's queue has stayed empty that long, so sessions of
+ * vanished clients do not stay in the map until their PID is reused.
+ */
+void	session_sweep(t_worker *worker)
+{
+	t_session	*session;
+	t_session	*next;
+	long		now;
+
+	now = session_clock_ms();
+	session = worker->live;
+	while (session)
+	{
+		next = session->next;
+		if (now - session->last_ms >= SESSION_IDLE_MS)
+			session_drop(worker, session);
+		session = next;
+	}
+}
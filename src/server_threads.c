@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_threads.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:50:36 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:54:36 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minitalk.h"
+
+/**
+ * @brief Worker thread: decodes the bits of its share of the clients.
+ * While it holds sessions it sleeps at most SESSION_IDLE_MS, and a
+ * silence that long means every session left is stale: it is swept.
+ */
+static void	*worker_main(void *arg)
+{
+	t_worker	*worker;
+	uint64_t	event;
+
+	worker = arg;
+	while (1)
+	{
+		if (evq_pop(&worker->queue, &event, worker->live != NULL))
+			session_receive_bit(worker, (pid_t)(event >> 1), event & 1);
+		else
+			session_sweep(worker);
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Undoes a start that failed part way: cancels and joins the
+ * `started` threads (they are asleep in evq_pop(), a cancellation point,
+ * as no signal is taken before the dispatcher runs), then destroys the
+ * `ready` semaphores and frees everything.
+ * @return NULL, for start_workers() to return.
+ */
+static t_worker	*stop_workers(t_worker *workers, int started, int ready)
+{
+	int	i;
+
+	i = 0;
+	while (workers && i < started)
+	{
+		pthread_cancel(workers[i].thread);
+		pthread_join(workers[i].thread, NULL);
+		i++;
+	}
+	i = 0;
+	while (workers && i < ready)
+	{
+		sem_destroy(&workers[i].queue.wake);
+		ft_hmap_free(&workers[i].sessions, NULL);
+		i++;
+	}
+	free(workers);
+	return (NULL);
+}
+
+/**
+ * @brief Starts the workers. The transport signals are blocked first, so
+ * every thread inherits the mask and only the dispatcher ever takes them.
+ * @return The workers, or NULL on failure, with nothing left running.
+ */
+static t_worker	*start_workers(int count, sigset_t *signals,
+		pthread_mutex_t *out_lock)
+{
+	t_worker	*workers;
+	int			i;
+
+	workers = ft_calloc(count, sizeof(t_worker));
+	if (!workers || sigemptyset(signals) == -1
+		|| sigaddset(signals, SIG_BIT_ONE) == -1
+		|| sigaddset(signals, SIG_BIT_ZERO) == -1
+		|| pthread_sigmask(SIG_BLOCK, signals, NULL) != 0)
+		return (stop_workers(workers, 0, 0));
+	i = 0;
+	while (i < count)
+	{
+		ft_hmap_init(&workers[i].sessions, 0);
+		workers[i].out_lock = out_lock;
+		if (sem_init(&workers[i].queue.wake, 0, 0) == -1)
+			return (stop_workers(workers, i, i));
+		if (pthread_create(&workers[i].thread, NULL, worker_main,
+				&workers[i]) != 0)
+			return (stop_workers(workers, i, i + 1));
+		i++;
+	}
+	return (workers);
+}
+
+/**
+ * @brief Runs the server with a dispatcher and `count` worker threads.
+ * The calling thread becomes the dispatcher: it takes each signal with
+ * sigwaitinfo() and queues it to the worker picked from a hash of the
+ * sender's PID, so a client's bits always reach the same worker in order
+ * while different clients are decoded and printed in parallel.
+ * @return FAILURE if the workers could not be started; does not return
+ * otherwise.
+ */
+int	run_threaded_server(int count)
+{
+	static pthread_mutex_t	out_lock = PTHREAD_MUTEX_INITIALIZER;
+	t_worker				*workers;
+	sigset_t				signals;
+	siginfo_t				info;
+	uint32_t				shard;
+
+	workers = start_workers(count, &signals, &out_lock);
+	if (!workers)
+	{
+		ft_putstr_fd("Error: could not start the worker threads.\n",
+			FD_STDERR);
+		return (FAILURE);
+	}
+	ft_printf("Server ready with %d workers. Waiting for signals...\n", count);
+	while (1)
+	{
+		if (sigwaitinfo(&signals, &info) == -1)
+			continue ;
+		shard = ((uint64_t)((uint32_t)info.si_pid * 2654435761u) * count) >> 32;
+		evq_push(&workers[shard].queue, ((uint64_t)(uint32_t)info.si_pid << 1)
+			| (info.si_signo == SIG_BIT_ONE));
+	}
+	return (SUCCESS);
+}
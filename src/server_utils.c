@@ -6,86 +6,103 @@
 /*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/05 19:14:16 by fyudris           #+#    #+#             */
-/*   Updated: 2025/06/05 19:43:24 by fyudris          ###   ########.fr       */
+/*   Updated: 2026/10/18 14:48:56 by fyudris          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/minitalk.h"
 
 /**
- * @brief Resizes the dynamic message buffer if it's full.
- * @return SUCCESS or FAILURE.
+ * @brief Returns the message being assembled and its receipt. They live
+ * here rather than in the volatile g_state (see t_server_text).
+ * @return The server's message builder and receipt.
  */
-static int	resize_buffer_if_needed(void)
+t_server_text	*server_text(void)
 {
-	size_t	new_capacity;
-	char	*resized_buffer;
+	static t_server_text	text;
 
-	if (g_state.message_len + 1 < g_state.buffer_capacity)
-		return (SUCCESS);
-	if (g_state.buffer_capacity == 0)
-		new_capacity = INITIAL_BUFFER_CAPACITY;
-	else
-		new_capacity = g_state.buffer_capacity * 2;
-	resized_buffer = ft_realloc(g_state.message_buffer,
-			g_state.message_len, new_capacity);
-	if (!resized_buffer && new_capacity > 0)
-	{
-		ft_putstr_fd("Error: ft_realloc failed.\n", FD_STDERR);
-		return (FAILURE);
-	}
-	g_state.message_buffer = resized_buffer;
-	g_state.buffer_capacity = new_capacity;
-	if (!g_state.message_buffer && new_capacity > 0)
-		return (FAILURE);
-	return (SUCCESS);
+	return (&text);
 }
 
 /**
  * @brief Initializes or resets the server's global state for message reception.
- * Frees any previously allocated message buffer, allocates a new initial buffer,
- * and resets all state variables.
+ * Empties the message builder and resets all state variables. Heap storage
+ * up to MESSAGE_KEEP_CAPACITY is kept for the next message; a mapped
+ * (multi-megabyte) buffer keeps its address range but its pages are handed
+ * back to the kernel right away. A registered server publishes whether it
+ * is now busy with a message.
  * @param client_pid The PID of the new client. If 0, general reset.
- * @return int Returns SUCCESS (0) or FAILURE (1).
+ * @return int Returns SUCCESS (0).
  */
 int	init_server_state(pid_t client_pid)
 {
-	if (g_state.message_buffer)
-	{
-		free(g_state.message_buffer);
-		g_state.message_buffer = NULL;
-	}
+	if ((client_pid != 0) != (g_state.active_client_pid != 0))
+		registry_update((client_pid != 0) - (g_state.active_client_pid != 0),
+			0);
+	if (!server_text()->message.mapped
+		&& server_text()->message.cap > MESSAGE_KEEP_CAPACITY)
+		ft_sb_free(&server_text()->message);
+	else
+		ft_sb_clear(&server_text()->message);
 	g_state.char_in_progress = 0;
 	g_state.bits_received = 0;
-	g_state.message_len = 0;
 	g_state.active_client_pid = client_pid;
-	g_state.buffer_capacity = INITIAL_BUFFER_CAPACITY;
-	g_state.message_buffer = (char *)malloc(g_state.buffer_capacity);
-	if (!g_state.message_buffer)
-	{
-		ft_putstr_fd("Error: Server malloc failed.\n", FD_STDERR);
-		g_state.buffer_capacity = 0;
-		return (FAILURE);
-	}
-	g_state.message_buffer[0] = '\0';
+	g_state.fec_stream = 0;
+	g_state.fec_bits = 0;
+	g_state.fec_gap_at = 0;
+	g_state.fec_dropping = 0;
+	receipt_init(&server_text()->receipt, NULL, 0);
+	g_state.pipelined = 0;
+	g_state.pipeline_count = 0;
 	return (SUCCESS);
 }
 
 /**
- * @brief Appends a character to the dynamic message buffer.
+ * @brief Appends a character to the message being assembled.
  * @param c The character to append.
  * @return int SUCCESS or FAILURE.
  */
 int	append_char_to_buffer(unsigned char c)
 {
-	if (!g_state.message_buffer)
+	if (ft_sb_append_char(&server_text()->message, c) == -1)
 	{
-		if (init_server_state(g_state.active_client_pid) == FAILURE)
-			return (FAILURE);
-	}
-	if (resize_buffer_if_needed() == FAILURE)
+		ft_putstr_fd("Error: Server malloc failed.\n", FD_STDERR);
 		return (FAILURE);
-	g_state.message_buffer[g_state.message_len++] = c;
-	g_state.message_buffer[g_state.message_len] = '\0';
+	}
 	return (SUCCESS);
 }
+
+/**
+ * @brief Prints a finished message followed by a newline, in one write()
+ * whenever it fits in the writer's buffer.
+ * @param message The message to print.
+ */
+void	server_print_message(t_strbuf *message)
+{
+	t_bufwriter	out;
+
+	ft_bw_init(&out, FD_STDOUT, 0);
+	if (message->len > 0)
+		ft_bw_putbytes(&out, message->data, message->len);
+	ft_bw_putchar(&out, '\n');
+	ft_bw_flush(&out);
+}
+
+/**
+ * @brief (BONUS) Tells a client that its message has been received. The
+ * ACK is queued with the receipt of what was received as its payload, so
+ * the client can check the message arrived intact.
+ * Members of a broadcast group answer with SIG_GROUP_ACK instead of SIG_ACK
+ * (see join_server_group).
+ * @param client_pid The client to acknowledge.
+ * @param receipt What the server received of the message.
+ */
+void	server_send_ack(pid_t client_pid, const t_receipt *receipt)
+{
+	union sigval	value;
+
+	value.sival_ptr = (void *)(uintptr_t)receipt_value(receipt);
+	if (sigqueue(client_pid, g_state.ack_signal, value) == -1)
+		ft_dprintf(FD_STDERR, "Server: Failed to send ACK to %d.\n",
+			client_pid);
+}
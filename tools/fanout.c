@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:14:41 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:14:41 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * Example user of the async side of libminitalk.a: queues <copies> copies
+ * of a message to every server given, then drives all of them from one
+ * loop in this single thread. Prints each failed transfer, and at the
+ * end how many transfers succeeded and how long the whole fan-out took.
+ *
+ * Usage: ./fanout <copies> <message> <server_pid>...
+ */
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include "../includes/libminitalk.h"
+#include "../libft/includes/libft.h"
+#include "../libft/includes/ft_printf.h"
+
+static long	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000L + ts.tv_nsec / 1000000L);
+}
+
+static void	on_done(void *arg, long id, pid_t pid, int error)
+{
+	if (error)
+		ft_dprintf(2, "fanout: transfer %d to %d: %s\n", (int)id, (int)pid,
+			strerror(error));
+	else
+		(*(long *)arg)++;
+}
+
+/**
+ * @brief Queues `copies` messages to each of the `count` servers, one
+ * round over all servers at a time.
+ * @return The number of transfers queued, or -1 on a bad PID.
+ */
+static long	queue_all(t_mt_loop *loop, int copies, const char *message,
+		char **pids)
+{
+	long	queued;
+	int		i;
+
+	queued = 0;
+	while (copies-- > 0)
+	{
+		i = 0;
+		while (pids[i])
+		{
+			if (mt_send_async(loop, ft_atoi(pids[i]), message,
+					ft_strlen(message)) == -1)
+				return (-1);
+			queued++;
+			i++;
+		}
+	}
+	return (queued);
+}
+
+int	main(int argc, char **argv)
+{
+	t_mt_loop	*loop;
+	long		ok;
+	long		queued;
+	long		start;
+
+	if (argc < 4 || ft_atoi(argv[1]) <= 0)
+	{
+		ft_dprintf(2, "Usage: %s <copies> <message> <server_pid>...\n",
+			argv[0]);
+		return (1);
+	}
+	ok = 0;
+	loop = mt_loop_open(on_done, &ok);
+	queued = -1;
+	if (loop)
+		queued = queue_all(loop, ft_atoi(argv[1]), argv[2], argv + 3);
+	start = now_ms();
+	if (queued < 0 || mt_loop_run(loop) == -1)
+		ft_dprintf(2, "fanout: cannot send: %s\n", strerror(errno));
+	else
+		ft_printf("%d/%d transfers to %d servers in %d ms\n", (int)ok,
+			(int)queued, argc - 3, (int)(now_ms() - start));
+	mt_loop_close(loop);
+	return (queued < 0 || ok != queued);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fec_check.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:11:24 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:11:24 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * Regression check for fec_repair_block() (see src/fec_repair.c).
+ *
+ * Encodes <blocks> blocks of pseudo-random data (and a few fixed ones),
+ * deletes each of the FEC_BLOCK_BITS signals of every block in turn, and
+ * repairs what is left. A repair may fail (-1: the message is dropped),
+ * but it must never hand back bytes other than the ones sent. One line is
+ * printed per wrong repair, then a summary; the exit status is non-zero if
+ * any repair was wrong.
+ *
+ * Usage: ./fec_check [blocks]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "../includes/minitalk.h"
+
+#define CHECK_DEFAULT_BLOCKS	2000
+
+static const unsigned char	g_fixed[][FEC_BLOCK_BYTES] = {
+{0x07, 0x96, 0xB1, 0x6B}, {0x00, 0x00, 0x00, 0x00},
+{0xFF, 0xFF, 0xFF, 0xFF}, {'a', 'b', 'c', 'd'}, {'4', '2', '\0', '\0'}};
+
+/**
+ * @brief Removes signal `pos` (counted from the first sent) from a block.
+ * @return The FEC_BLOCK_BITS - 1 signals left, first one highest.
+ */
+static unsigned long long	delete_bit(unsigned long long stream, int pos)
+{
+	int	shift;
+
+	shift = FEC_BLOCK_BITS - 1 - pos;
+	return ((stream & ((1ULL << shift) - 1))
+		| ((stream >> shift >> 1) << shift));
+}
+
+/**
+ * @brief Deletes each signal of the block holding `data` in turn.
+ * @return The number of wrong repairs; counts[0] and counts[1] get the
+ * repairs that were right and the ones refused.
+ */
+static int	check_block(const unsigned char *data, long counts[2])
+{
+	unsigned char		out[FEC_BLOCK_BYTES];
+	unsigned long long	stream;
+	int					wrong;
+	int					pos;
+
+	stream = fec_encode_block(data);
+	wrong = 0;
+	pos = -1;
+	while (++pos < FEC_BLOCK_BITS)
+	{
+		if (fec_repair_block(delete_bit(stream, pos), out) < 0)
+			counts[1]++;
+		else if (ft_memcmp(out, data, FEC_BLOCK_BYTES) == 0)
+			counts[0]++;
+		else
+		{
+			printf("wrong: %02x%02x%02x%02x lost bit %d, got "
+				"%02x%02x%02x%02x\n", data[0], data[1], data[2], data[3],
+				pos, out[0], out[1], out[2], out[3]);
+			wrong++;
+		}
+	}
+	return (wrong);
+}
+
+int	main(int argc, char **argv)
+{
+	unsigned char	data[FEC_BLOCK_BYTES];
+	long			counts[2];
+	long			blocks;
+	long			wrong;
+	long			i;
+
+	blocks = CHECK_DEFAULT_BLOCKS;
+	if (argc > 1)
+		blocks = atol(argv[1]);
+	counts[0] = 0;
+	counts[1] = 0;
+	wrong = 0;
+	i = -1;
+	while (++i < (long)(sizeof(g_fixed) / sizeof(g_fixed[0])))
+		wrong += check_block(g_fixed[i], counts);
+	srand(42);
+	i = -1;
+	while (++i < blocks * FEC_BLOCK_BYTES)
+	{
+		data[i % FEC_BLOCK_BYTES] = rand();
+		if (i % FEC_BLOCK_BYTES == FEC_BLOCK_BYTES - 1)
+			wrong += check_block(data, counts);
+	}
+	printf("%ld repairs: %ld right, %ld refused, %ld wrong\n",
+		counts[0] + counts[1] + wrong, counts[0], counts[1], wrong);
+	return (wrong != 0);
+}
@@ -0,0 +1,240 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   merge.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:59:53 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 15:15:41 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * Merge tool for striped messages (client -s <pid>... <message>).
+ *
+ * Every server of a striped send prints one record per stripe:
+ *
+ *     @stripe:<pid>.<stamp>:<seq>:<count>:<len>:<len bytes of the message>
+ *
+ * where <pid>.<stamp> identifies the send: the PID of the sending client
+ * and the time it started, so a reused PID starts a new message. The tool
+ * reads the output of
+ * all servers (files named on the command line, or stdin), cuts the records
+ * out by length (a stripe may contain newlines), and prints each message
+ * whose stripes are all present, stripes in order, one message per line.
+ * Other lines (banners, plain messages) are ignored. Incomplete messages are
+ * reported on stderr and make the exit status non-zero.
+ *
+ * Usage: ./merge [server_output...]
+ */
+#include <stdio.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include "../includes/minitalk.h"
+
+typedef struct s_stripe
+{
+	long		pid;
+	uint64_t	stamp;
+	int			seq;
+	int			count;
+	const char	*data;
+	size_t		len;
+}	t_stripe;
+
+typedef struct s_merge
+{
+	t_strbuf	text;
+	t_stripe	*stripes;
+	size_t		n;
+	size_t		cap;
+}	t_merge;
+
+static int	read_all(t_strbuf *text, int fd)
+{
+	ssize_t	n;
+
+	n = 1;
+	while (n > 0)
+	{
+		if (ft_sb_reserve(text, 65536) == -1)
+			return (FAILURE);
+		n = read(fd, text->data + text->len, 65536);
+		if (n > 0)
+			text->len += n;
+	}
+	if (n < 0 || ft_sb_append_char(text, '\n') == -1)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @brief Parses the record starting at `line`, if it is one.
+ * @return The length of the record with its newline, or 0 if `line` is not
+ * a complete record.
+ */
+static size_t	parse_record(t_merge *m, const char *line, size_t left)
+{
+	t_stripe	s;
+	int			head;
+	t_stripe	*grown;
+
+	head = 0;
+	if (ft_strncmp(line, STRIPE_TAG, ft_strlen(STRIPE_TAG)) != 0
+		|| sscanf(line + ft_strlen(STRIPE_TAG), "%ld.%" SCNu64 ":%d:%d:%zu:%n",
+			&s.pid, &s.stamp, &s.seq, &s.count, &s.len, &head) != 5
+		|| head == 0)
+		return (0);
+	head += ft_strlen(STRIPE_TAG);
+	if (s.seq < 0 || s.seq >= s.count || s.len >= left - head
+		|| line[head + s.len] != '\n')
+		return (0);
+	s.data = line + head;
+	if (m->n == m->cap)
+	{
+		grown = realloc(m->stripes, (m->cap * 2 + 64) * sizeof(t_stripe));
+		if (!grown)
+			return (0);
+		m->stripes = grown;
+		m->cap = m->cap * 2 + 64;
+	}
+	m->stripes[m->n++] = s;
+	return (head + s.len + 1);
+}
+
+static int	cmp_stripe(const void *a, const void *b)
+{
+	const t_stripe	*x;
+	const t_stripe	*y;
+
+	x = a;
+	y = b;
+	if (x->pid != y->pid)
+		return ((x->pid > y->pid) - (x->pid < y->pid));
+	if (x->stamp != y->stamp)
+		return ((x->stamp > y->stamp) - (x->stamp < y->stamp));
+	return (x->seq - y->seq);
+}
+
+/**
+ * @brief Prints the stripes s[0..end) in order, skipping duplicates.
+ */
+static void	print_message(const t_stripe *s, size_t end)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < end)
+	{
+		if (i == 0 || s[i].seq != s[i - 1].seq)
+			fwrite(s[i].data, 1, s[i].len, stdout);
+		i++;
+	}
+	fputc('\n', stdout);
+}
+
+/**
+ * @brief Prints the message made of the stripes s[0..] sharing one id,
+ * skipping duplicate stripes. Records of one id that disagree on the
+ * stripe count cannot belong to one send, and the message is refused.
+ * @return The number of stripes consumed; *complete says whether every
+ * stripe of the message was there.
+ */
+static size_t	emit_message(const t_stripe *s, size_t n, int *complete)
+{
+	size_t	end;
+	int		have;
+	int		mixed;
+
+	end = 0;
+	have = 0;
+	mixed = 0;
+	while (end < n && s[end].pid == s[0].pid && s[end].stamp == s[0].stamp)
+	{
+		have += (end == 0 || s[end].seq != s[end - 1].seq);
+		mixed |= (s[end].count != s[0].count);
+		end++;
+	}
+	*complete = (!mixed && have == s[0].count);
+	if (mixed)
+		fprintf(stderr, "merge: message %ld.%" PRIu64 " has stripes with "
+			"different counts\n", s[0].pid, s[0].stamp);
+	else if (!*complete)
+		fprintf(stderr, "merge: message %ld.%" PRIu64 " incomplete (%d/%d "
+			"stripes)\n", s[0].pid, s[0].stamp, have, s[0].count);
+	if (*complete)
+		print_message(s, end);
+	return (end);
+}
+
+/**
+ * @brief Reads every input into one buffer, newline-separated.
+ */
+static int	load(t_merge *m, int argc, char **argv)
+{
+	int	fd;
+	int	i;
+
+	if (argc == 1)
+		return (read_all(&m->text, STDIN_FILENO));
+	i = 1;
+	while (i < argc)
+	{
+		fd = open(argv[i], O_RDONLY);
+		if (fd == -1 || read_all(&m->text, fd) == FAILURE)
+		{
+			perror(argv[i]);
+			return (FAILURE);
+		}
+		close(fd);
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @brief Collects the records line by line; a record is skipped as a
+ * whole, so stripe bytes that look like a record are never parsed.
+ */
+static void	collect(t_merge *m)
+{
+	char	*text;
+	size_t	pos;
+	size_t	used;
+
+	text = ft_sb_cstr(&m->text);
+	pos = 0;
+	while (pos < m->text.len)
+	{
+		used = parse_record(m, text + pos, m->text.len - pos);
+		if (!used)
+			used = ft_strchr(text + pos, '\n') - (text + pos) + 1;
+		pos += used;
+	}
+}
+
+int	main(int argc, char **argv)
+{
+	t_merge	m;
+	size_t	pos;
+	int		complete;
+	int		status;
+
+	ft_bzero(&m, sizeof(m));
+	if (load(&m, argc, argv) == FAILURE)
+		return (FAILURE);
+	collect(&m);
+	qsort(m.stripes, m.n, sizeof(t_stripe), cmp_stripe);
+	status = SUCCESS;
+	pos = 0;
+	while (pos < m.n)
+	{
+		pos += emit_message(m.stripes + pos, m.n - pos, &complete);
+		if (!complete)
+			status = FAILURE;
+	}
+	free(m.stripes);
+	ft_sb_free(&m.text);
+	return (status);
+}
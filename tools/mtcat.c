@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mtcat.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:08:29 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 14:08:29 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * Example user of libminitalk.a: sends every line of stdin to a server as
+ * its own message, over a single connection (no ./client per line).
+ * Empty lines are skipped. Prints how many messages went out and how long
+ * that took, which makes it a quick way to compare with a loop of ./client.
+ *
+ * Usage: ./mtcat <server_pid> < lines.txt
+ */
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include "../includes/libminitalk.h"
+#include "../libft/includes/libft.h"
+#include "../libft/includes/ft_printf.h"
+
+static int	read_all(t_strbuf *text, int fd)
+{
+	ssize_t	n;
+
+	n = 1;
+	while (n > 0)
+	{
+		if (ft_sb_reserve(text, 65536) == -1)
+			return (-1);
+		n = read(fd, text->data + text->len, 65536);
+		if (n > 0)
+			text->len += n;
+	}
+	return (-(n < 0));
+}
+
+static long	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000L + ts.tv_nsec / 1000000L);
+}
+
+/**
+ * @brief Sends each non-empty line of `text` over `conn`.
+ * @return The number of messages sent, or -1 (error printed) on failure.
+ */
+static long	send_lines(t_mt_conn *conn, const t_strbuf *text)
+{
+	const char	*line;
+	const char	*end;
+	const char	*stop;
+	long		sent;
+
+	line = text->data;
+	stop = text->data + text->len;
+	sent = 0;
+	while (line < stop)
+	{
+		end = ft_memchr(line, '\n', stop - line);
+		if (!end)
+			end = stop;
+		if (end > line && mt_send(conn, line, end - line) == -1)
+		{
+			ft_dprintf(2, "mtcat: message %ld: %s\n", sent + 1,
+				strerror(errno));
+			return (-1);
+		}
+		sent += (end > line);
+		line = end + 1;
+	}
+	return (sent);
+}
+
+int	main(int argc, char **argv)
+{
+	t_mt_conn	*conn;
+	t_strbuf	text;
+	long		start;
+	long		sent;
+
+	if (argc != 2)
+	{
+		ft_dprintf(2, "Usage: %s <server_pid> < lines\n", argv[0]);
+		return (1);
+	}
+	ft_sb_init(&text);
+	conn = mt_open(ft_atoi(argv[1]));
+	sent = -1;
+	if (!conn || read_all(&text, 0) == -1)
+		ft_dprintf(2, "mtcat: %s\n", strerror(errno));
+	else
+	{
+		start = now_ms();
+		sent = send_lines(conn, &text);
+		if (sent >= 0)
+			ft_printf("Sent %d messages in %d ms\n", (int)sent,
+				(int)(now_ms() - start));
+	}
+	mt_close(conn);
+	ft_sb_free(&text);
+	return (sent < 0);
+}
@@ -0,0 +1,433 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stress.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fyudris <fyudris@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:27:47 by fyudris           #+#    #+#             */
+/*   Updated: 2026/10/18 12:27:47 by fyudris          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+ * Stress harness for the Minitalk server.
+ *
+ * For N = 1, 2, 4, ... up to <max_clients>, the harness starts a fresh server,
+ * forks N clients at once, each sending a self-describing payload of the form
+ *
+ *     <id>:<body_len>:<fnv1a(body) in hex>:<body>
+ *
+ * and then parses the server's stdout to count how many payloads arrived
+ * intact, how many lines were corrupted and how many messages were lost.
+ * One table row is printed per N, giving a scaling curve for the server
+ * binary under test (mandatory build, bonus build, ...).
+ *
+ * Usage: ./stress <server> <client> <max_clients> [payload_len] [-- args]
+ * Arguments after `--` are forwarded to the server.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <sys/wait.h>
+#include "../includes/minitalk.h"
+
+#define STRESS_DEFAULT_LEN	64
+#define STRESS_DRAIN_MS		750
+#define STRESS_BANNER		"Server PID: "
+
+typedef struct s_stress
+{
+	char	*server;
+	char	*client;
+	char	**server_argv;
+	int		max_clients;
+	size_t	payload_len;
+}	t_stress;
+
+typedef struct s_run
+{
+	int		clients;
+	pid_t	server_pid;
+	int		out_fd;
+	char	*out;
+	size_t	out_len;
+	size_t	out_cap;
+	int		delivered;
+	int		corrupt;
+	int		duplicate;
+	long	elapsed_ms;
+}	t_run;
+
+static long	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000L + ts.tv_nsec / 1000000L);
+}
+
+static unsigned int	fnv1a(const char *s, size_t len)
+{
+	unsigned int	h;
+	size_t			i;
+
+	h = 2166136261u;
+	i = 0;
+	while (i < len)
+	{
+		h ^= (unsigned char)s[i++];
+		h *= 16777619u;
+	}
+	return (h);
+}
+
+/**
+ * @brief Builds the deterministic payload for client `id`.
+ * The body is pseudo-random alphanumeric text seeded by `id`, so the harness
+ * can recompute and verify it without keeping copies around.
+ */
+static char	*make_payload(int id, size_t body_len)
+{
+	static const char	alphabet[] = "abcdefghijklmnopqrstuvwxyz"
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+	char				*payload;
+	unsigned int		seed;
+	size_t				i;
+	int					head;
+
+	payload = malloc(body_len + 48);
+	if (!payload)
+		return (NULL);
+	seed = (unsigned int)id * 2654435761u + 1;
+	head = snprintf(payload, 48, "%d:%zu:", id, body_len);
+	i = 0;
+	while (i < body_len)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		payload[head + 9 + i++] = alphabet[seed % (sizeof(alphabet) - 1)];
+	}
+	payload[head + 9 + body_len] = '\0';
+	snprintf(payload + head, 10, "%08x", fnv1a(payload + head + 9, body_len));
+	payload[head + 8] = ':';
+	return (payload);
+}
+
+/**
+ * @brief Appends whatever the server has written so far to run->out.
+ * @return Number of bytes read, 0 on EOF/timeout, -1 on error.
+ */
+static ssize_t	drain_output(t_run *run, int timeout_ms)
+{
+	struct pollfd	pfd;
+	ssize_t			n;
+	char			*grown;
+
+	pfd.fd = run->out_fd;
+	pfd.events = POLLIN;
+	if (poll(&pfd, 1, timeout_ms) <= 0)
+		return (0);
+	if (run->out_len + 4096 > run->out_cap)
+	{
+		grown = realloc(run->out, run->out_cap * 2 + 4096);
+		if (!grown)
+			return (-1);
+		run->out = grown;
+		run->out_cap = run->out_cap * 2 + 4096;
+	}
+	n = read(run->out_fd, run->out + run->out_len, 4095);
+	if (n > 0)
+		run->out_len += n;
+	return (n);
+}
+
+/**
+ * @brief Forks the server under test with its stdout redirected into a pipe
+ * and waits for its PID banner.
+ * @return SUCCESS or FAILURE.
+ */
+static int	start_server(t_stress *cfg, t_run *run)
+{
+	int		fds[2];
+	long	deadline;
+	char	*banner;
+
+	if (pipe(fds) == -1)
+		return (FAILURE);
+	run->server_pid = fork();
+	if (run->server_pid == -1)
+		return (FAILURE);
+	if (run->server_pid == 0)
+	{
+		dup2(fds[1], FD_STDOUT);
+		close(fds[0]);
+		close(fds[1]);
+		execv(cfg->server, cfg->server_argv);
+		_exit(127);
+	}
+	close(fds[1]);
+	run->out_fd = fds[0];
+	deadline = now_ms() + 2000;
+	banner = NULL;
+	while (!banner && now_ms() < deadline && drain_output(run, 100) >= 0)
+	{
+		if (run->out)
+			run->out[run->out_len] = '\0';
+		if (run->out && ft_strchr(run->out, '\n'))
+			banner = strstr(run->out, STRESS_BANNER);
+	}
+	if (!banner || atoi(banner + ft_strlen(STRESS_BANNER)) != run->server_pid)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+static pid_t	spawn_client(t_stress *cfg, pid_t server_pid, char *payload)
+{
+	pid_t	pid;
+	char	pid_arg[16];
+	int		devnull;
+
+	pid = fork();
+	if (pid != 0)
+		return (pid);
+	snprintf(pid_arg, sizeof(pid_arg), "%d", server_pid);
+	devnull = open("/dev/null", O_WRONLY);
+	dup2(devnull, FD_STDOUT);
+	dup2(devnull, FD_STDERR);
+	execl(cfg->client, cfg->client, pid_arg, payload, (char *) NULL);
+	_exit(127);
+}
+
+/**
+ * @brief Launches all clients at once and reaps them, draining the server's
+ * output meanwhile so a full pipe never stalls the server.
+ */
+static int	run_clients(t_stress *cfg, t_run *run, char **payloads)
+{
+	pid_t	*pids;
+	int		alive;
+	int		i;
+	long	start;
+
+	pids = calloc(run->clients, sizeof(pid_t));
+	if (!pids)
+		return (FAILURE);
+	start = now_ms();
+	i = -1;
+	alive = 0;
+	while (++i < run->clients)
+	{
+		pids[i] = spawn_client(cfg, run->server_pid, payloads[i]);
+		alive += (pids[i] > 0);
+	}
+	while (alive > 0)
+	{
+		drain_output(run, 5);
+		i = -1;
+		while (++i < run->clients)
+		{
+			if (pids[i] > 0 && waitpid(pids[i], NULL, WNOHANG) == pids[i])
+			{
+				pids[i] = 0;
+				alive--;
+			}
+		}
+	}
+	run->elapsed_ms = now_ms() - start;
+	free(pids);
+	while (drain_output(run, STRESS_DRAIN_MS) > 0)
+		;
+	return (SUCCESS);
+}
+
+/**
+ * @brief Checks one line of server output against the payload format.
+ * @return The client id if the line is an intact payload, -1 otherwise.
+ */
+static int	check_line(const char *line, size_t len, int clients)
+{
+	int				id;
+	size_t			body_len;
+	unsigned int	sum;
+	int				head;
+
+	head = 0;
+	if (sscanf(line, "%d:%zu:%8x:%n", &id, &body_len, &sum, &head) != 3
+		|| head == 0 || id < 0 || id >= clients)
+		return (-1);
+	if (len - head != body_len || fnv1a(line + head, body_len) != sum)
+		return (-1);
+	return (id);
+}
+
+static void	verify_output(t_run *run)
+{
+	char	*seen;
+	char	*line;
+	char	*eol;
+	int		id;
+
+	if (!run->out)
+		return ;
+	seen = calloc(run->clients, 1);
+	if (!seen)
+		return ;
+	run->out[run->out_len] = '\0';
+	line = run->out;
+	eol = ft_strchr(line, '\n');
+	while (eol)
+	{
+		*eol = '\0';
+		id = check_line(line, eol - line, run->clients);
+		if (id >= 0 && seen[id])
+			run->duplicate++;
+		else if (id >= 0)
+		{
+			seen[id] = 1;
+			run->delivered++;
+		}
+		else if (ft_strncmp(line, "Server", 6) != 0)
+			run->corrupt++;
+		line = eol + 1;
+		eol = ft_strchr(line, '\n');
+	}
+	free(seen);
+}
+
+static int	run_once(t_stress *cfg, t_run *run, char **payloads)
+{
+	int	status;
+
+	status = start_server(cfg, run);
+	if (status == SUCCESS)
+		status = run_clients(cfg, run, payloads);
+	if (run->server_pid > 0)
+	{
+		kill(run->server_pid, SIGTERM);
+		waitpid(run->server_pid, NULL, 0);
+	}
+	if (status == SUCCESS)
+		verify_output(run);
+	if (run->out_fd > 0)
+		close(run->out_fd);
+	free(run->out);
+	return (status);
+}
+
+static void	print_row(t_stress *cfg, t_run *run)
+{
+	double	secs;
+	int		lost;
+
+	secs = run->elapsed_ms / 1000.0;
+	if (secs <= 0)
+		secs = 0.001;
+	lost = run->clients - run->delivered;
+	printf("%8d %10d %6d %8d %5d %11ld %10.1f %12.0f\n", run->clients,
+		run->delivered, lost, run->corrupt, run->duplicate, run->elapsed_ms,
+		run->delivered / secs, run->delivered * cfg->payload_len / secs);
+	fflush(stdout);
+}
+
+static int	parse_args(int argc, char **argv, t_stress *cfg)
+{
+	int	i;
+
+	if (argc < 4)
+		return (FAILURE);
+	cfg->server = argv[1];
+	cfg->client = argv[2];
+	cfg->max_clients = atoi(argv[3]);
+	cfg->payload_len = STRESS_DEFAULT_LEN;
+	i = 4;
+	if (i < argc && ft_strncmp(argv[i], "--", 3) != 0)
+		cfg->payload_len = atol(argv[i++]);
+	if (i < argc && ft_strncmp(argv[i], "--", 3) == 0)
+		i++;
+	cfg->server_argv = argv + i - 1;
+	cfg->server_argv[0] = cfg->server;
+	if (cfg->max_clients <= 0)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+static char	**make_payloads(t_stress *cfg)
+{
+	char	**payloads;
+	int		i;
+
+	payloads = calloc(cfg->max_clients + 1, sizeof(char *));
+	if (!payloads)
+		return (NULL);
+	i = -1;
+	while (++i < cfg->max_clients)
+	{
+		payloads[i] = make_payload(i, cfg->payload_len);
+		if (!payloads[i])
+		{
+			ft_free_array(payloads);
+			return (NULL);
+		}
+	}
+	return (payloads);
+}
+
+/**
+ * @brief Runs the sweep N = 1, 2, 4, ..., max_clients.
+ * @return SUCCESS if every run delivered every payload intact, FAILURE
+ * otherwise, so the harness can gate regressions in scripts.
+ */
+static int	sweep(t_stress *cfg, char **payloads)
+{
+	t_run	run;
+	int		clients;
+	int		status;
+
+	status = SUCCESS;
+	clients = 1;
+	while (clients <= cfg->max_clients)
+	{
+		ft_bzero(&run, sizeof(run));
+		run.clients = clients;
+		if (run_once(cfg, &run, payloads) == FAILURE)
+		{
+			fprintf(stderr, "stress: cannot run %s\n", cfg->server);
+			return (FAILURE);
+		}
+		print_row(cfg, &run);
+		if (run.delivered != run.clients || run.corrupt || run.duplicate)
+			status = FAILURE;
+		if (clients < cfg->max_clients && clients * 2 > cfg->max_clients)
+			clients = cfg->max_clients;
+		else
+			clients *= 2;
+	}
+	return (status);
+}
+
+int	main(int argc, char **argv)
+{
+	t_stress	cfg;
+	char		**payloads;
+	int			status;
+
+	if (parse_args(argc, argv, &cfg) == FAILURE)
+	{
+		fprintf(stderr, "Usage: %s <server> <client> <max_clients> "
+			"[payload_len] [-- server_args...]\n", argv[0]);
+		return (FAILURE);
+	}
+	payloads = make_payloads(&cfg);
+	if (!payloads)
+		return (FAILURE);
+	printf("%8s %10s %6s %8s %5s %11s %10s %12s\n", "clients", "delivered",
+		"lost", "corrupt", "dup", "elapsed_ms", "msgs/s", "bytes/s");
+	status = sweep(&cfg, payloads);
+	ft_free_array(payloads);
+	return (status);
+}